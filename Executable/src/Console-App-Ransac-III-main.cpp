@@ -31,6 +31,7 @@ using ITableBuilder = ConsoleAppRansacIINamespace::IO::ITableBuilder;
 using TableFacade = ConsoleAppRansacIINamespace::IO::TableFacade;
 using Table = ConsoleAppRansacIINamespace::Core::Table;
 using Column = ConsoleAppRansacIINamespace::Core::Column;
+using ColumnView = ConsoleAppRansacIINamespace::Core::ColumnView;
 using LeastSquaresFitStrategy = ConsoleAppRansacIINamespace::Fitting::LeastSquaresFitStrategy;
 using RANSACFitStrategy = ConsoleAppRansacIINamespace::Fitting::RANSACFitStrategy;
 using TableExport = ConsoleAppRansacIINamespace::IO::TableExport;
@@ -51,9 +52,9 @@ int main(int argc, char* argv[])
 	constexpr char tableName[] = "Test Table";
 	TableFacade tableFacade{ tableName, tableBuilder };
 
-	Column abcissa = tableFacade.getColumn(0);
-	Column ordinate = tableFacade.getColumn(1);
-	std::vector<double> abcissaValues = abcissa.getAllRows();
+	// the views read the table in place, they are used before the fitted columns are appended to it
+	ColumnView abcissa = tableFacade.getColumnView(0);
+	ColumnView ordinate = tableFacade.getColumnView(1);
 	
 	// Least Squares Fit
 	cout << "Performing Least Squares Fit" << endl;
@@ -61,9 +62,8 @@ int main(int argc, char* argv[])
 	LinearModel leastSquaresLinearFit;
 	leastSquaresLinearFit = leastSquaresFitStrategy.fitLinearModel(abcissa, ordinate);
 
-	std::vector<double> leastSquaresOrdinateValues = leastSquaresLinearFit.getMultipleValuesAt(abcissaValues);
-	Column leastSquaresOrdinate{ leastSquaresOrdinateValues, "Least Squares Fit"};
-	tableFacade.appendColumn(leastSquaresOrdinate);
+	std::vector<double> leastSquaresOrdinateValues(abcissa.getNoOfRows());
+	leastSquaresLinearFit.evaluate(abcissa.data(), abcissa.getNoOfRows(), leastSquaresOrdinateValues.data());
 
 	// RANSAC Fit
 	cout << "Performing RANSAC Fit" << endl;
@@ -71,7 +71,11 @@ int main(int argc, char* argv[])
 	LinearModel ransacLinearFit;
 	ransacLinearFit = ransacFitStrategy.fitLinearModel(abcissa, ordinate);
 
-	std::vector<double> ransacOrdinateValues = ransacLinearFit.getMultipleValuesAt(abcissaValues);
+	std::vector<double> ransacOrdinateValues(abcissa.getNoOfRows());
+	ransacLinearFit.evaluate(abcissa.data(), abcissa.getNoOfRows(), ransacOrdinateValues.data());
+
+	Column leastSquaresOrdinate{ leastSquaresOrdinateValues, "Least Squares Fit"};
+	tableFacade.appendColumn(leastSquaresOrdinate);
 	Column ransacOrdinate{ ransacOrdinateValues, "RANSAC Fit" };
 	tableFacade.appendColumn(ransacOrdinate);
 
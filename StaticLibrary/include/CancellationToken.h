@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Core {
+
+/**
+* @class CancellationToken
+* @brief The flag a caller raises to ask a running computation to finish early.
+*
+* The computation polls the flag between its steps and returns its best result so far,
+* so checking it costs one relaxed atomic load.
+*/
+class CancellationToken {
+  public:
+	/**
+	* @brief Constructor for the CancellationToken class, the token is not cancelled.
+	*/
+	CancellationToken() : _cancelled{ false } {}
+
+	/**
+	* @brief Copy constructor (deleted, the computation and the caller have to share one token)
+	*/
+	CancellationToken(const CancellationToken& other) = delete;
+
+	/**
+	* @brief Copy assignment operator (deleted, the computation and the caller have to share one token)
+	*/
+	CancellationToken& operator=(const CancellationToken& other) = delete;
+
+	/**
+	* @brief Ask the computations polling the token to finish, it may be called from any thread.
+	*/
+	void cancel() {
+		_cancelled.store(true, std::memory_order_relaxed);
+	}
+
+	/**
+	* @brief Check if the token was cancelled.
+	* @return True if cancel() was called.
+	*/
+	bool isCancelled() const {
+		return _cancelled.load(std::memory_order_relaxed);
+	}
+
+  private:
+	/**
+	* @brief The flag raised by cancel().
+	*/
+	std::atomic<bool> _cancelled;
+};
+
+} // namespace Core
+} // namespace ConsoleAppRansacIINamespace
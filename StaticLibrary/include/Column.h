@@ -16,77 +16,118 @@
 #include "Common.h"
 #include "IColumn.h"
 
+#include <cstdint>
+#include <memory_resource>
+#include <ostream>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <stdexcept>
+#include <type_traits>
 
 namespace ConsoleAppRansacIINamespace {
 namespace Core {
 
 /**
-* @class Column
+* @class BasicColumn
 * @brief A class to represent a column of values.
+* @tparam T The type of the values: double, float, int32_t or int64_t.
 * 
-* The 'Column' class provides a way to store a column of values.
-* Each column has a header (string) and a vector of values (doubles).
+* The 'BasicColumn' class provides a way to store a column of values.
+* Each column has a header (string) and a vector of values (of the type T).
+* The float and the integer columns store their values as they are, e.g. float32 sensor data
+* or integer timestamps, the averages and the fits of their values are accumulated in double.
+* The member functions are compiled once for the supported types in Column.cpp.
+*
+* The values and the header are allocated from a polymorphic memory resource, e.g. a monotonic arena
+* shared by a whole table. A copy of a column is allocated from the default resource unless a resource
+* is given, so a copy may outlive the arena of the original; a moved column keeps its resource.
 * 
 * Features:
 * - Add a row to the column.
 * - Get the number of rows in the column.
 * - Get the header of the column.
 * - Get all the values in the column.
+* - Get a read-only view of the values in the column without copying them.
 * - Get the value at a specified row index.
 * - Get the values at specified row indexes.
 * - Get the average of the values in the column.
+* - Allocate the values and the header from a given memory resource.
 * - Output the column to an output stream.
 * - Exception handling for out of bounds row indexes.
 * - Exception handling for bad memory allocation.
 *
 */
-class Column : public IColumn
+template <typename T>
+class BasicColumn : public BasicIColumn<T>
 {  
+	static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value
+		|| std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value,
+		"The column values have to be double, float, int32_t or int64_t");
+
   public:
 	/**
-	* @brief Constructor for the Column class.
+	* @brief The type of the values.
+	*/
+	using value_type = T;
+
+	/**
+	* @brief Constructor for the BasicColumn class.
 	* @param rowVector A vector of values to be stored in the column.
 	* @param header The header of the column.
+	* @param pMemoryResource The memory resource to allocate the values and the header from.
 	*/
-	Column(const std::vector<double>& rowVector, const std::string header); 
+	BasicColumn(const std::vector<T>& rowVector, const std::string header,
+		std::pmr::memory_resource* pMemoryResource = std::pmr::get_default_resource());
+
+	/**
+	* @brief Constructor taking over the values allocated from a memory resource, without copying them.
+	* @param rowVector The values to be stored in the column, the column uses their memory resource.
+	* @param header The header of the column.
+	*/
+	BasicColumn(std::pmr::vector<T>&& rowVector, std::string_view header);
 
 	/**
 	* @brief Copy constructor
+	* @param other The other column to be copied, the copy is allocated from the default memory resource.
+	*/
+	BasicColumn(const BasicColumn& other) = default;
+
+	/**
+	* @brief Copy constructor allocating the copy from a memory resource.
 	* @param other The other column to be copied.
+	* @param pMemoryResource The memory resource to allocate the values and the header of the copy from.
 	*/
-	Column(const Column& other) = default;
+	BasicColumn(const BasicColumn& other, std::pmr::memory_resource* pMemoryResource);
 
 	/**
 	* @brief Move constructor
 	* @param other The other column to be moved.
 	*/
-	Column(Column&& other) = default;
+	BasicColumn(BasicColumn&& other) = default;
 
 	/**
 	* @brief Copy assignment operator
-	* @param other The other column to be copied.
+	* @param other The other column to be copied, into the memory resource of this column.
 	*/
-	Column& operator=(const Column& other) = default;
+	BasicColumn& operator=(const BasicColumn& other) = default;
 
 	/**
 	* @brief Move assignment operator
 	* @param other The other column to be moved.
 	*/
-	Column& operator=(Column&& other) = default;
+	BasicColumn& operator=(BasicColumn&& other) = default;
 
 	/**
 	* @brief Destructor
 	*/
-	~Column() = default;
+	~BasicColumn() = default;
 
 	/**
 	* @brief Add a row to the column values
-	* @param value The double value to be added as a new row
+	* @param value The value to be added as a new row
 	*/
-	virtual void addRow(const double value) override;
+	virtual void addRow(const T value) override;
 
 	/**
 	* @brief Get number of rows in the column
@@ -104,25 +145,56 @@ class Column : public IColumn
 	* @brief Get all rows from the Column
 	* @return A vector of all the values in the column
 	*/
-	virtual std::vector<double> getAllRows() const override;
+	virtual std::vector<T> getAllRows() const override;
+
+	/**
+	* @brief Get the contiguous values of the column without copying them
+	* @return The pointer to getNoOfRows() values, valid until a row is added
+	*/
+	const T* getData() const { return _colValues.data(); }
+
+	/**
+	* @brief Get the memory resource the values and the header are allocated from
+	* @return The memory resource of the column
+	*/
+	std::pmr::memory_resource* getMemoryResource() const { return _colValues.get_allocator().resource(); }
+
+	/**
+	* @brief Get the read-only view of the contiguous values and the header of the column
+	* @return The view, valid until a row is added or the column is destroyed
+	*/
+	virtual BasicColumnView<T> getView() const override { return BasicColumnView<T>{ _colValues.data(), _noRows, _colHeader }; }
 
 	/**
 	* @brief Get the value at a specified row index
 	* @param specifiedRowIndex The index of the row to get the value from
 	* @return The value at the specified row index
+	* @note The index is checked by one branch, the exception message is built only when it is thrown.
+	*/
+	virtual T getOneRow(const size_t& specifiedRowIndex) const override {
+		if (specifiedRowIndex >= _noRows) {
+			throwRowIndexOutOfBounds(specifiedRowIndex);
+		}
+		return _colValues[specifiedRowIndex];
+	}
+
+	/**
+	* @brief Get the value at a specified row index without checking the index
+	* @param specifiedRowIndex The index of the row to get the value from, less than getNoOfRows()
+	* @return The value at the specified row index
 	*/
-	virtual double getOneRow(const size_t& specifiedRowIndex) const override;
+	T getOneRowUnchecked(size_t specifiedRowIndex) const noexcept { return _colValues[specifiedRowIndex]; }
 
 	/**
 	* @brief Get the values at specified row indexes
 	* @param specifiedRowIndexes A vector of picked indexes of the rows to get the values from
 	* @return A vector of the values at the specified row indexed
 	*/
-	Column getSpecifiedRows(const std::vector<size_t>& specifiedRowIndexes) const;
+	BasicColumn getSpecifiedRows(const std::vector<size_t>& specifiedRowIndexes) const;
 
 	/**
 	* @brief Get the average of the values in the column
-	* @return The average of the values in the column
+	* @return The average of the values in the column, accumulated in double
 	*/
 	virtual double getAverage() const override;
 
@@ -132,7 +204,8 @@ class Column : public IColumn
 	* @param column The column to output
 	* @return The output stream
 	*/
-	friend std::ostream& operator<<(std::ostream& os, const Column& column);
+	template <typename U>
+	friend std::ostream& operator<<(std::ostream& os, const BasicColumn<U>& column);
 
 	/**
 	* @class RowIndexOutOfBounds
@@ -164,7 +237,7 @@ class Column : public IColumn
 	/**
 	* @brief The vector of values in the column
 	*/
-	std::vector<double> _colValues;
+	std::pmr::vector<T> _colValues;
 	
 	/**
 	* @brief The number of rows in the column
@@ -174,14 +247,20 @@ class Column : public IColumn
 	/**
 	* @brief The header of the column
 	*/
-	std::string _colHeader;
+	std::pmr::string _colHeader;
 
 	/**
 	* @brief Get the values at selected indexes
 	* @param selectedIndexes The indexes of the rows to get the values from
 	* @return A vector of the values at the selected indexes
 	*/
-	std::vector<double> getValuesAtSelectedIndexes(const std::vector<size_t>& selectedIndexes) const;
+	std::vector<T> getValuesAtSelectedIndexes(const std::vector<size_t>& selectedIndexes) const;
+
+	/**
+	* @brief Throw the exception for a row index out of bounds, kept out of line so the checked access stays small
+	* @param index The index out of bounds
+	*/
+	[[noreturn]] void throwRowIndexOutOfBounds(size_t index) const;
 
 	/**
 	* @brief Get the message that contains index and column header
@@ -189,5 +268,30 @@ class Column : public IColumn
 	std::string getIndexAndColumnNameMessage(const size_t& index) const;
 };
 
+/**
+* @brief Output the column to an output stream
+* @param os The output stream to output the column to
+* @param column The column to output
+* @return The output stream
+*/
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const BasicColumn<T>& column);
+
+extern template class BasicColumn<double>;
+extern template class BasicColumn<float>;
+extern template class BasicColumn<int32_t>;
+extern template class BasicColumn<int64_t>;
+
+/**
+* @brief The column of doubles, the values of the tables and of the fits.
+*/
+using Column = BasicColumn<double>;
+
+using FloatColumn = BasicColumn<float>;
+
+using Int32Column = BasicColumn<int32_t>;
+
+using Int64Column = BasicColumn<int64_t>;
+
 } // namespace Core
 } // namespace ConsoleAppRansacIINamespace
\ No newline at end of file
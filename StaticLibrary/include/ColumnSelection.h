@@ -0,0 +1,195 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "Column.h"
+#include "ColumnView.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Core {
+
+/**
+* @brief The number of the rows a gather prefetches ahead of the row it copies.
+*/
+constexpr size_t gatherPrefetchDistance = 16;
+
+/**
+* @brief Copy the values at the row indexes to the contiguous output, prefetching the rows ahead of the copied one.
+* @param values The values the rows are selected from.
+* @param rowIndexes The indexes of the selected rows, any order, each less than the number of the values.
+* @param noOfSelectedRows The number of the selected rows.
+* @param selectedValues The output array of noOfSelectedRows values.
+* @note The rows are not checked, the indexes of a RowSelection are checked when it is applied to a column.
+*/
+void gatherRows(const double* values, const size_t* rowIndexes, size_t noOfSelectedRows, double* selectedValues);
+
+/**
+* @class RowSelection
+* @brief The selection vector: the indexes of the selected rows, shared by the selections of several columns.
+*
+* Features:
+* - Select the rows by a list of indexes or by a bitmask, e.g. the inlier mask of a fit.
+* - Get the number of the selected rows and the index of each of them.
+*/
+class RowSelection {
+  public:
+	/**
+	* @brief Constructor of an empty selection.
+	*/
+	RowSelection() = default;
+
+	/**
+	* @brief Constructor for the RowSelection class.
+	* @param rowIndexes The indexes of the selected rows, in the order of the selection.
+	*/
+	explicit RowSelection(std::vector<size_t> rowIndexes) : _rowIndexes{ std::move(rowIndexes) } {}
+
+	/**
+	* @brief Constructor of the selection of the rows set in a bitmask, in the increasing order.
+	* @param maskWords The mask of (noOfRows + 63) / 64 words, the bit (index % 64) of the word (index / 64) selects the row.
+	* @param noOfRows The number of the rows the mask covers.
+	*/
+	RowSelection(const uint64_t* maskWords, size_t noOfRows);
+
+	/**
+	* @brief Get the number of the selected rows.
+	* @return The number of the selected rows.
+	*/
+	size_t size() const { return _rowIndexes.size(); }
+
+	/**
+	* @brief Get the index of a selected row.
+	* @param selectedRow The position of the row in the selection.
+	* @return The index of the row in the column.
+	*/
+	size_t operator[](size_t selectedRow) const { return _rowIndexes[selectedRow]; }
+
+	/**
+	* @brief Get the indexes of the selected rows.
+	* @return The pointer to size() row indexes.
+	*/
+	const size_t* data() const { return _rowIndexes.data(); }
+
+	/**
+	* @brief Get the largest selected row index plus one.
+	* @return The number of the rows a column needs to have, 0 for an empty selection.
+	*/
+	size_t getRequiredNoOfRows() const;
+
+  private:
+	/**
+	* @brief The indexes of the selected rows.
+	*/
+	std::vector<size_t> _rowIndexes;
+};
+
+/**
+* @class ColumnSelection
+* @brief A column with a selection of its rows, the values are read in place and copied only on request.
+*
+* The selection pairs the view of a base column with a shared selection vector, so selecting the rows of a column
+* copies no values, and the abcissa and ordinate selected by one set of rows share the row indexes.
+* The selected values are read through the selection, or gathered into a contiguous buffer by materialize.
+*
+* Features:
+* - Get the number of the selected rows, the header and a selected value.
+* - Gather a range of the selected values into a buffer, e.g. a chunk of a fit.
+* - Materialize the selection into a vector or a new column.
+* - Exception handling for the selected rows out of the bounds of the base column.
+*/
+class ColumnSelection {
+  public:
+	/**
+	* @brief Constructor for the ColumnSelection class.
+	* @param base The view of the base column, it has to outlive the selection.
+	* @param pRows The selected rows, shared with the selections of the other columns.
+	* @throws std::invalid_argument If pRows is null.
+	* @throws Column::RowIndexOutOfBounds If a selected row is out of the base column.
+	*/
+	ColumnSelection(ColumnView base, std::shared_ptr<const RowSelection> pRows);
+
+	/**
+	* @brief Get the number of the selected rows.
+	* @return The number of the selected rows.
+	*/
+	size_t getNoOfRows() const { return _pRows->size(); }
+
+	/**
+	* @brief Get the header of the base column.
+	* @return The view of the header of the base column.
+	*/
+	std::string_view getHeader() const { return _base.getHeader(); }
+
+	/**
+	* @brief Get the view of the base column.
+	* @return The view of all the rows of the base column.
+	*/
+	ColumnView getBase() const { return _base; }
+
+	/**
+	* @brief Get the selected rows.
+	* @return The selection vector.
+	*/
+	const RowSelection& getRows() const { return *_pRows; }
+
+	/**
+	* @brief Get a selected value.
+	* @param selectedRow The position of the row in the selection, less than getNoOfRows().
+	* @return The value of the base column at the selected row.
+	*/
+	double operator[](size_t selectedRow) const { return _base[(*_pRows)[selectedRow]]; }
+
+	/**
+	* @brief Gather a range of the selected values into a contiguous buffer.
+	* @param firstSelectedRow The position of the first gathered row in the selection.
+	* @param noOfSelectedRows The number of the gathered rows.
+	* @param values The output array of noOfSelectedRows values.
+	*/
+	void materialize(size_t firstSelectedRow, size_t noOfSelectedRows, double* values) const {
+		gatherRows(_base.data(), _pRows->data() + firstSelectedRow, noOfSelectedRows, values);
+	}
+
+	/**
+	* @brief Gather all the selected values.
+	* @return The vector of the selected values.
+	*/
+	std::vector<double> materialize() const;
+
+	/**
+	* @brief Gather all the selected values into a new column.
+	* @param header The header of the new column.
+	* @return The column of the selected values.
+	*/
+	Column materializeColumn(const std::string& header) const;
+
+  private:
+	/**
+	* @brief The view of the base column.
+	*/
+	ColumnView _base;
+
+	/**
+	* @brief The selected rows.
+	*/
+	std::shared_ptr<const RowSelection> _pRows;
+};
+
+} // namespace Core
+} // namespace ConsoleAppRansacIINamespace
@@ -0,0 +1,129 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Core {
+
+/**
+* @class BasicColumnView
+* @brief A read-only, non-owning view of the contiguous values and the header of a column.
+* @tparam T The type of the values, see BasicColumn.
+*
+* A view is two pointers and a count, it is passed by value and copying it copies no values.
+* It stays valid as long as the viewed column is alive and no row is added to it,
+* the columns of a table as long as the table is not modified.
+*
+* Features:
+* - Get the number of rows and the header.
+* - Get the contiguous values, iterate them or index them without bounds checking.
+*/
+template <typename T>
+class BasicColumnView {
+  public:
+	/**
+	* @brief The type of the values.
+	*/
+	using value_type = T;
+
+	/**
+	* @brief Constructor of an empty view.
+	*/
+	BasicColumnView() = default;
+
+	/**
+	* @brief Constructor for the BasicColumnView class.
+	* @param data The pointer to the contiguous values.
+	* @param noOfRows The number of values.
+	* @param header The header of the column.
+	*/
+	BasicColumnView(const T* data, size_t noOfRows, std::string_view header = {})
+		: _data{ data }, _noOfRows{ noOfRows }, _header{ header }
+	{}
+
+	/**
+	* @brief Get the pointer to the contiguous values.
+	* @return The pointer to getNoOfRows() values.
+	*/
+	const T* data() const { return _data; }
+
+	/**
+	* @brief Get the number of rows.
+	* @return The number of the viewed values.
+	*/
+	size_t size() const { return _noOfRows; }
+
+	/**
+	* @brief Get the number of rows.
+	* @return The number of the viewed values.
+	*/
+	size_t getNoOfRows() const { return _noOfRows; }
+
+	/**
+	* @brief Check if the view has no rows.
+	* @return True if there are no values.
+	*/
+	bool empty() const { return _noOfRows == 0; }
+
+	/**
+	* @brief Get the column header.
+	* @return The view of the header of the column.
+	*/
+	std::string_view getHeader() const { return _header; }
+
+	/**
+	* @brief Get the value at a row index, the index is not checked.
+	* @param rowIndex The index of the row, less than getNoOfRows().
+	* @return The value at the row index.
+	*/
+	T operator[](size_t rowIndex) const { return _data[rowIndex]; }
+
+	const T* begin() const { return _data; }
+
+	const T* end() const { return _data + _noOfRows; }
+
+  private:
+	/**
+	* @brief The pointer to the contiguous values.
+	*/
+	const T* _data = nullptr;
+
+	/**
+	* @brief The number of the viewed values.
+	*/
+	size_t _noOfRows = 0;
+
+	/**
+	* @brief The header of the column.
+	*/
+	std::string_view _header;
+};
+
+/**
+* @brief The view of a column of doubles, the values of the tables and of the fits.
+*/
+using ColumnView = BasicColumnView<double>;
+
+using FloatColumnView = BasicColumnView<float>;
+
+using Int32ColumnView = BasicColumnView<int32_t>;
+
+using Int64ColumnView = BasicColumnView<int64_t>;
+
+} // namespace Core
+} // namespace ConsoleAppRansacIINamespace
@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+/**
+* @brief The x86-64 kernels are compiled only for the x86-64 targets, the other targets use the scalar kernels.
+*
+* GCC and Clang need the instruction set of a kernel to be enabled by the target attribute,
+* MSVC accepts the intrinsics of any instruction set without it.
+*/
+#if defined(__x86_64__) || defined(_M_X64)
+#define RANSAC_III_X86_64_KERNELS 1
+#if defined(__GNUC__) || defined(__clang__)
+#define RANSAC_III_TARGET_AVX2 __attribute__((target("avx2")))
+#define RANSAC_III_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define RANSAC_III_TARGET_AVX2
+#define RANSAC_III_TARGET_AVX512
+#endif
+#endif
+
+namespace ConsoleAppRansacIINamespace {
+namespace Core {
+
+/**
+* @brief The instruction sets the vectorized kernels are compiled for, ordered from the slowest.
+*/
+enum class InstructionSet {
+	Scalar,
+	SSE2,
+	AVX2,
+	AVX512
+};
+
+/**
+* @brief Check if the instruction set can be used on the running CPU and operating system.
+* @param instructionSet The instruction set to check.
+* @return True if the kernels of the instruction set can be run, false otherwise.
+*/
+bool isInstructionSetSupported(InstructionSet instructionSet);
+
+/**
+* @brief Get the fastest instruction set supported by the running CPU.
+* @return The instruction set, detected once and cached.
+*/
+InstructionSet getBestSupportedInstructionSet();
+
+/**
+* @brief Get the name of the instruction set.
+* @param instructionSet The instruction set.
+* @return The name, e.g. "AVX2".
+*/
+std::string getInstructionSetName(InstructionSet instructionSet);
+
+} // namespace Core
+} // namespace ConsoleAppRansacIINamespace
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "Common.h"
+#include "ColumnView.h"
 
 #include <vector>
 #include <string>
@@ -22,17 +23,19 @@ namespace ConsoleAppRansacIINamespace {
 namespace Core {
 
 	/**
-	* @class IColumn
+	* @class BasicIColumn
 	* @brief The interface class to represent a column of values.
+	* @tparam T The type of the values, see BasicColumn.
 	*
-	* The 'IColumn' class provides a contract object to store a column of values.
-	* Each column has a header (string) and a vector of values (doubles).
+	* The 'BasicIColumn' class provides a contract object to store a column of values.
+	* Each column has a header (string) and a vector of values (of the type T).
 	*
 	* Features:
 	* - Add a row to the column.
 	* - Get the number of rows in the column.
 	* - Get the header of the column.
 	* - Get all the values in the column.
+	* - Get a read-only view of the values in the column without copying them.
 	* - Get the value at a specified row index.
 	* - Get the values at specified row indexes.
 	* - Get the average of the values in the column.
@@ -41,17 +44,18 @@ namespace Core {
 	* - Exception handling for bad memory allocation.
 	*
 	*/
-	class IColumn
+	template <typename T>
+	class BasicIColumn
 	{
 	public:
 		
-		virtual ~IColumn() = default;
+		virtual ~BasicIColumn() = default;
 
 		/**
 		* @brief Add a row to the column values
-		* @param value The double value to be added as a new row
+		* @param value The value to be added as a new row
 		*/
-		virtual void addRow(const double value) = 0;
+		virtual void addRow(const T value) = 0;
 
 		/**
 		* @brief Get number of rows in the column
@@ -69,14 +73,31 @@ namespace Core {
 		* @brief Get all rows from the Column
 		* @return A vector of all the values in the column
 		*/
-		virtual std::vector<double> getAllRows() const = 0;
+		virtual std::vector<T> getAllRows() const = 0;
+
+		/**
+		* @brief Get the read-only view of the contiguous values and the header of the column
+		* @return The view, valid until a row is added or the column is destroyed
+		*/
+		virtual BasicColumnView<T> getView() const = 0;
+
+		/**
+		* @brief Convert the column to its view, so the column can be passed where a view is expected
+		* @return The view of the column
+		*/
+		operator BasicColumnView<T>() const& { return getView(); }
+
+		/**
+		* @brief A temporary column is not converted, its view would dangle once the column is destroyed
+		*/
+		operator BasicColumnView<T>() const&& = delete;
 
 		/**
 		* @brief Get the value at a specified row index
 		* @param specifiedRowIndex The index of the row to get the value from
 		* @return The value at the specified row index
 		*/
-		virtual double getOneRow(const size_t& specifiedRowIndex) const = 0;
+		virtual T getOneRow(const size_t& specifiedRowIndex) const = 0;
 
 		/**
 		* @brief Get the values at specified row indexes
@@ -87,10 +108,15 @@ namespace Core {
 
 		/**
 		* @brief Get the average of the values in the column
-		* @return The average of the values in the column
+		* @return The average of the values in the column, accumulated in double
 		*/
 		virtual double getAverage() const = 0;
 	};
 
+	/**
+	* @brief The interface of a column of doubles.
+	*/
+	using IColumn = BasicIColumn<double>;
+
 } // namespace Core
 } // namespace ConsoleAppRansacIINamespace
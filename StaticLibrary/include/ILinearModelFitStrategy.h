@@ -16,8 +16,12 @@
 #include "Column.h"
 #include "LinearModel.h"
 
+#include <stdexcept>
+#include <string>
+
 using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
 using Column = ConsoleAppRansacIINamespace::Core::Column;
+using ColumnView = ConsoleAppRansacIINamespace::Core::ColumnView;
 
 namespace ConsoleAppRansacIINamespace {
 namespace Fitting {
@@ -35,11 +39,32 @@ class ILinearModelFitStrategy {
 
     /**
 	* @brief Fits a linear model to a set of data points.
-	* @param abcissa The abcissa values of the data points.
-	* @param ordinate The ordinate values of the data points.
+	* @param abcissa The view of the abcissa values of the data points, a Column converts to its view.
+	* @param ordinate The view of the ordinate values of the data points.
 	* @return The linear model that fits the (abcissa,ordinate).
     */
-	virtual LinearModel fitLinearModel(const Column& abcissa, const Column& ordinate) = 0;
+	virtual LinearModel fitLinearModel(ColumnView abcissa, ColumnView ordinate) = 0;
+
+	/**
+	* @brief Exception for the abcissa and the ordinate of different numbers of rows, the same type the linear model throws.
+	*/
+	using DifferentNoOfRows = LinearModel::DifferentNoOfRows;
+
+  protected:
+	/**
+	* @brief Check that the abcissa and the ordinate have the same number of rows, before their values are read in place.
+	* @param abcissa The view or the selection of the abcissa values of the data points.
+	* @param ordinate The view or the selection of the ordinate values of the data points.
+	* @throw DifferentNoOfRows If the numbers of rows differ.
+	*/
+	template <typename Values>
+	static void checkNoOfRows(const Values& abcissa, const Values& ordinate) {
+		if (abcissa.getNoOfRows() != ordinate.getNoOfRows()) {
+			throw DifferentNoOfRows("The abcissa and the ordinate have different numbers of rows |"
+				" Column name: " + std::string{ abcissa.getHeader() } + " Rows: " + std::to_string(abcissa.getNoOfRows()) +
+				" Column name: " + std::string{ ordinate.getHeader() } + " Rows: " + std::to_string(ordinate.getNoOfRows()));
+		}
+	}
 };
 
 } // namespace Fitting
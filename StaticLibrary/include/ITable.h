@@ -33,6 +33,7 @@ namespace Core {
 	* - Get the name of the table.
 	* - Get the common number of rows in all columns.
 	* - Get a column from the table.
+	* - Get a read-only view of a column without copying it.
 	* - Get a cell value from the table.
 	* - Output the table to an output stream.
 	* - Exception handling for out of bounds column indexes.
@@ -78,6 +79,13 @@ namespace Core {
 		*/
 		virtual Column getColumn(size_t index) const = 0;
 
+		/**
+		* @brief Get the read-only view of the column of the specified index, without copying the column.
+		* @param index The index of the column to view.
+		* @return The view of the column, valid until the table is modified or destroyed.
+		*/
+		virtual ColumnView getColumnView(size_t index) const = 0;
+
 		/**
 		* @brief Get the value of the cell at the specified row and column indexes.
 		* @param cellRowIndex The row index of the cell.
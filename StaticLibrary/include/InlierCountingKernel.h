@@ -0,0 +1,154 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "CpuFeatures.h"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+/**
+* @brief The number of data points marked by one word of the inlier mask.
+*/
+constexpr size_t inlierMaskWordBits = 64;
+
+/**
+* @brief Get the number of the mask words needed to mark the data points.
+* @param noOfPoints The number of data points.
+* @return The number of 64-bit words.
+*/
+constexpr size_t getInlierMaskWords(size_t noOfPoints) {
+	return (noOfPoints + inlierMaskWordBits - 1) / inlierMaskWordBits;
+}
+
+/**
+* @brief Count the data points closer to the line Y = slope * X + yIntercept than the threshold, i.e. |yIntercept + slope * x - y| < threshold.
+* @param abcissa The contiguous abcissa values of the data points.
+* @param ordinate The contiguous ordinate values of the data points.
+* @param noOfPoints The number of data points.
+* @param yIntercept The y-intercept of the line.
+* @param slope The slope of the line.
+* @param threshold The threshold value to be considered as an inlier.
+* @param inlierMask The mask of getInlierMaskWords(noOfPoints) words, the bit (index % 64) of the word (index / 64) is set for an inlier.
+* @return The number of inliers.
+* @note The kernel of the fastest instruction set supported by the running CPU is used.
+*/
+size_t countInliers(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask);
+
+/**
+* @brief Count the inliers of the line with the kernel of the given instruction set.
+* @param instructionSet The instruction set, it has to be supported by the running CPU.
+* @see countInliers for the other parameters.
+*/
+size_t countInliers(
+	Core::InstructionSet instructionSet,
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask);
+
+/**
+* @brief Count the inliers of the line and sum their squared residuals in the same pass.
+* @param abcissa The contiguous abcissa values of the data points.
+* @param ordinate The contiguous ordinate values of the data points.
+* @param noOfPoints The number of data points.
+* @param yIntercept The y-intercept of the line.
+* @param slope The slope of the line.
+* @param threshold The threshold value to be considered as an inlier.
+* @param inlierMask The mask of getInlierMaskWords(noOfPoints) words, the bit (index % 64) of the word (index / 64) is set for an inlier.
+* @param inlierSquaredResiduals The sum of the squared residuals of the inliers.
+* @return The number of inliers.
+* @note The truncated losses of MSAC and MLESAC follow from the count and the sum, the outliers contribute a constant each.
+* The order of the summation, and so the rounding of the sum, depends on the instruction set.
+*/
+size_t scoreInliers(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask, double& inlierSquaredResiduals);
+
+/**
+* @brief Count and score the inliers of the line with the kernel of the given instruction set.
+* @param instructionSet The instruction set, it has to be supported by the running CPU.
+* @see scoreInliers for the other parameters.
+*/
+size_t scoreInliers(
+	Core::InstructionSet instructionSet,
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask, double& inlierSquaredResiduals);
+
+/**
+* @brief Store the squared residuals of the line that are not above the bound, packed at the front of the output.
+* @param abcissa The contiguous abcissa values of the data points.
+* @param ordinate The contiguous ordinate values of the data points.
+* @param noOfPoints The number of data points.
+* @param yIntercept The y-intercept of the line.
+* @param slope The slope of the line.
+* @param bound The largest squared residual stored, +infinity stores all of them.
+* @param squaredResiduals The output array of noOfPoints values, the first (returned count) of them are the stored residuals in the order of the data points.
+* @return The number of the stored squared residuals.
+* @note The rest of the output array is overwritten by the kernel as a scratch space. The residuals are computed
+* the same way by all the instruction sets, so the stored values do not depend on the kernel.
+*/
+size_t gatherSquaredResiduals(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double bound, double* squaredResiduals);
+
+/**
+* @brief Gather the bounded squared residuals of the line with the kernel of the given instruction set.
+* @param instructionSet The instruction set, it has to be supported by the running CPU.
+* @see gatherSquaredResiduals for the other parameters.
+*/
+size_t gatherSquaredResiduals(
+	Core::InstructionSet instructionSet,
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double bound, double* squaredResiduals);
+
+/**
+* @brief The number of data points in one tile of the batched counting, the abcissa and ordinate of a tile take 32 KiB.
+*/
+constexpr size_t inlierCountingTileSize = 2048;
+
+/**
+* @brief Count the inliers of a batch of lines, sweeping the data points once in cache-sized tiles.
+* @param abcissa The contiguous abcissa values of the data points.
+* @param ordinate The contiguous ordinate values of the data points.
+* @param noOfPoints The number of data points.
+* @param yIntercepts The y-intercepts of the lines.
+* @param slopes The slopes of the lines.
+* @param numberOfLines The number of lines in the batch.
+* @param threshold The threshold value to be considered as an inlier.
+* @param inlierCounts The output array of numberOfLines counts of the inliers.
+* @note Every line is scored against a tile while the tile stays in the cache,
+* so the data points are read from the memory once per batch instead of once per line.
+*/
+void countInliersInTiles(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	const double* yIntercepts, const double* slopes, size_t numberOfLines,
+	double threshold, size_t* inlierCounts);
+
+/**
+* @brief Count the inliers of a batch of lines with the kernel of the given instruction set.
+* @param instructionSet The instruction set, it has to be supported by the running CPU.
+* @see countInliersInTiles for the other parameters.
+*/
+void countInliersInTiles(
+	Core::InstructionSet instructionSet,
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	const double* yIntercepts, const double* slopes, size_t numberOfLines,
+	double threshold, size_t* inlierCounts);
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
@@ -0,0 +1,151 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "InlierCountingKernel.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+/**
+* @class InlierMask
+* @brief A consensus set stored as one bit per data point.
+*
+* The mask is filled by the inlier-counting kernel and reused from one hypothesis
+* to the next, so the consensus loop does not allocate memory.
+*
+* Features:
+* - Resize the mask to the number of data points.
+* - Check if a data point is an inlier, mark a data point as an inlier or an outlier.
+* - Count the inliers.
+* - Visit the inliers in the increasing order of their indexes.
+* - Get the dense vector of the inlier indexes.
+*/
+class InlierMask {
+  public:
+	/**
+	* @brief Constructor for the InlierMask class.
+	* @param noOfPoints The number of data points, all of them are outliers.
+	*/
+	explicit InlierMask(size_t noOfPoints = 0);
+
+	/**
+	* @brief Resize the mask, all the data points become outliers.
+	* @param noOfPoints The number of data points.
+	* @note The memory is reused if the mask has already been large enough.
+	*/
+	void reset(size_t noOfPoints);
+
+	/**
+	* @brief Get the number of data points.
+	* @return The number of data points marked by the mask.
+	*/
+	size_t getNoOfPoints() const { return _noOfPoints; }
+
+	/**
+	* @brief Get the number of inliers.
+	* @return The number of set bits.
+	*/
+	size_t getNumberOfInliers() const;
+
+	/**
+	* @brief Check if the data point is an inlier.
+	* @param index The index of the data point.
+	* @return True if the data point is an inlier, false otherwise.
+	*/
+	bool isInlier(size_t index) const {
+		return ((_words[index / inlierMaskWordBits] >> (index % inlierMaskWordBits)) & 1) != 0;
+	}
+
+	/**
+	* @brief Mark the data point as an inlier or an outlier.
+	* @param index The index of the data point.
+	* @param inlier True for an inlier, false for an outlier.
+	*/
+	void setInlier(size_t index, bool inlier = true) {
+		uint64_t bit = uint64_t{ 1 } << (index % inlierMaskWordBits);
+		if (inlier) {
+			_words[index / inlierMaskWordBits] |= bit;
+		}
+		else {
+			_words[index / inlierMaskWordBits] &= ~bit;
+		}
+	}
+
+	/**
+	* @brief Get the words of the mask, e.g. to be filled by countInliers.
+	* @return The pointer to getInlierMaskWords(getNoOfPoints()) words.
+	*/
+	uint64_t* getWords() { return _words.data(); }
+
+	/**
+	* @brief Get the words of the mask.
+	* @return The pointer to getInlierMaskWords(getNoOfPoints()) words.
+	*/
+	const uint64_t* getWords() const { return _words.data(); }
+
+	/**
+	* @brief Call the visitor with the index of each inlier in the increasing order.
+	* @param visitor The callable taking the index (size_t) of the inlier.
+	*/
+	template <typename Visitor>
+	void forEachInlier(Visitor&& visitor) const {
+		for (size_t wordIndex = 0; wordIndex < _words.size(); wordIndex++) {
+			for (uint64_t word = _words[wordIndex]; word != 0; word &= word - 1) {
+				visitor(wordIndex * inlierMaskWordBits + countTrailingZeros(word));
+			}
+		}
+	}
+
+	/**
+	* @brief Get the indexes of the inliers.
+	* @return The vector of the inlier indexes in the increasing order.
+	*/
+	std::vector<size_t> getInlierIndexes() const;
+
+  private:
+	/**
+	* @brief Get the index of the lowest set bit of a non-zero word.
+	*/
+	static size_t countTrailingZeros(uint64_t word);
+
+	/**
+	* @brief The words of the mask, 64 data points per word.
+	*/
+	std::vector<uint64_t> _words;
+
+	/**
+	* @brief The number of data points.
+	*/
+	size_t _noOfPoints;
+};
+
+inline size_t InlierMask::countTrailingZeros(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+	return static_cast<size_t>(__builtin_ctzll(word));
+#else
+	size_t bit = 0;
+	while ((word & 1) == 0) {
+		word >>= 1;
+		bit++;
+	}
+	return bit;
+#endif
+}
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
@@ -0,0 +1,137 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "ILinearModelFitStrategy.h"
+#include "InlierMask.h"
+#include "ThreadPool.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+/**
+* @struct LeastMedianOfSquaresFitReport
+* @brief The outcome of a least median of squares fit, the model together with the data points it was refined on.
+*/
+struct LeastMedianOfSquaresFitReport {
+	/**
+	* @brief The fitted linear model.
+	*/
+	LinearModel model;
+
+	/**
+	* @brief The median of the squared residuals of the best hypothesis.
+	*/
+	double medianOfSquaredResiduals = std::numeric_limits<double>::infinity();
+
+	/**
+	* @brief The robust estimate of the standard deviation of the residuals, derived from the median.
+	*/
+	double robustScale = std::numeric_limits<double>::infinity();
+
+	/**
+	* @brief The data points within 2.5 robust scales of the best hypothesis, the model is refined on these data points.
+	*/
+	InlierMask inlierMask;
+
+	/**
+	* @brief The number of the data points in the mask.
+	*/
+	size_t numberOfInliers = 0;
+
+	/**
+	* @brief The number of evaluated hypotheses.
+	*/
+	size_t numberOfIterations = 0;
+
+	/**
+	* @brief The number of the hypotheses whose median was selected, the others were ruled out by the bounded gathering.
+	*/
+	size_t numberOfMedianSelections = 0;
+};
+
+/**
+* @class LeastMedianOfSquaresFitStrategy
+* @brief The least median of squares (LMedS) fitting algorithm/strategy: the line minimizing the median of the squared residuals.
+*
+* The hypotheses are the lines through two data points drawn the same way as the RANSAC samples, one random stream
+* per iteration, and each one is scored by the median of its squared residuals. No inlier threshold is needed,
+* the estimator tolerates up to a half of the data points being outliers.
+*
+* The squared residuals not above the best median so far are gathered into a scratch buffer by a SIMD kernel,
+* a hypothesis with fewer than a half of the data points gathered cannot improve and is rejected by the count alone.
+* Otherwise its median is selected among the gathered residuals only, by std::nth_element. The hypotheses are
+* scored on the worker threads, each with its own scratch buffer, and the best one does not depend on the number of threads.
+*
+* The best hypothesis is refined by a least squares fit to the data points within 2.5 robust scales of it.
+*
+* @see P. J. Rousseeuw, Least Median of Squares Regression, Journal of the American Statistical Association 79, 1984.
+* @see P. J. Rousseeuw, A. M. Leroy, Robust Regression and Outlier Detection, Wiley 1987.
+*/
+class LeastMedianOfSquaresFitStrategy : public ILinearModelFitStrategy {
+public:
+	/**
+	* @brief The default number of hypotheses.
+	*/
+	static constexpr size_t defaultNumberOfIterations = 1000;
+
+	/**
+	* @brief Constructor.
+	* @param numberOfIterations The number of hypotheses.
+	* @param numberOfThreads The number of threads scoring the hypotheses, 1 means serial, 0 means one per hardware thread.
+	* @param randomSeed The seed of the random samples.
+	*/
+	explicit LeastMedianOfSquaresFitStrategy(size_t numberOfIterations = defaultNumberOfIterations, int numberOfThreads = 1, uint64_t randomSeed = 0);
+
+	/**
+	* @brief Fits a linear model to a set of data points using the least median of squares.
+	* @param abcissa The abcissa values of the data points.
+	* @param ordinate The ordinate values of the data points.
+	* @return The linear model that fits the (abcissa,ordinate), NaN slope and y-intercept if there is no hypothesis.
+	* @throw DifferentNoOfRows If the abcissa and the ordinate have different numbers of rows.
+	*/
+	virtual LinearModel fitLinearModel(ColumnView abcissa, ColumnView ordinate) override;
+
+	/**
+	* @brief Fits a linear model using the least median of squares and reports the median and the refinement set.
+	* @param abcissa The abcissa values of the data points.
+	* @param ordinate The ordinate values of the data points.
+	* @return The report of the fit.
+	* @throw DifferentNoOfRows If the abcissa and the ordinate have different numbers of rows.
+	*/
+	LeastMedianOfSquaresFitReport fitLinearModelWithReport(ColumnView abcissa, ColumnView ordinate);
+
+private:
+	/**
+	* @brief The number of hypotheses.
+	*/
+	size_t _numberOfIterations;
+
+	/**
+	* @brief The seed of the random samples.
+	*/
+	uint64_t _randomSeed;
+
+	/**
+	* @brief The worker threads, empty for the serial fit.
+	*/
+	std::shared_ptr<Core::ThreadPool> _pThreadPool;
+};
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
@@ -13,7 +13,12 @@
 
 #pragma once
 
+#include "ColumnSelection.h"
 #include "ILinearModelFitStrategy.h"
+#include "LinearSufficientStats.h"
+#include "ThreadPool.h"
+
+#include <memory>
 
 namespace ConsoleAppRansacIINamespace {
 namespace Fitting {
@@ -21,16 +26,96 @@ namespace Fitting {
 /**
 * @class LeastSquaresFitStrategy
 * @brief The Least Squares fitting algorithm/strategy for a linear model to a set of data points using the least squares method.
+*
+* The data points are split into chunks of a fixed size, the sufficient statistics of each chunk are accumulated
+* by the fused kernel (by the worker threads if there are any) and merged by a fixed pairwise tree.
+* The split and the order of the merges depend only on the number of the data points and the kernel keeps
+* the same lanes on every instruction set, so the fitted model is bitwise identical for any number of threads and any CPU.
+* The small inputs are accumulated in two scalar passes instead, so their fitted models are the same as before the kernel.
 */
 class LeastSquaresFitStrategy : public ILinearModelFitStrategy {
 public:
 	/**
+	* @brief The number of data points in one chunk of the reduction.
+	*/
+	static constexpr size_t chunkSize = size_t{ 1 } << 16;
+
+	/**
+	* @brief The largest number of data points accumulated in two scalar passes, they stay in the L2 cache.
+	*/
+	static constexpr size_t twoPassMaxNoOfPoints = 4096;
+
+	/**
+	* @brief Constructor.
+	* @param numberOfThreads The number of threads accumulating the chunks, 1 means serial, 0 means one per hardware thread.
+	*/
+	explicit LeastSquaresFitStrategy(int numberOfThreads = 1);
+
+	/**
     * @brief Fits a linear model to a set of data points using the Least Squares algorithm.
     * @param abcissa The abcissa values of the data points.
     * @param ordinate The ordinate values of the data points.
     * @return The linear model that fits the (abcissa,ordinate).
+    * @throw DifferentNoOfRows If the abcissa and the ordinate have different numbers of rows.
     */
-	virtual LinearModel fitLinearModel(const Column& abcissa, const Column& ordinate) override;
+	virtual LinearModel fitLinearModel(ColumnView abcissa, ColumnView ordinate) override;
+
+	/**
+	* @brief Get the sufficient statistics of the contiguous data points by the chunked reduction.
+	* @param abcissa The contiguous abcissa values of the data points.
+	* @param ordinate The contiguous ordinate values of the data points.
+	* @param noOfPoints The number of data points.
+	* @return The statistics, bitwise identical for any number of threads and any instruction set.
+	*/
+	LinearSufficientStats accumulate(const double* abcissa, const double* ordinate, size_t noOfPoints) const;
+
+	/**
+	* @brief Fits a linear model to the data points stored as float, int32_t or int64_t values.
+	* @param abcissa The abcissa values of the data points.
+	* @param ordinate The ordinate values of the data points.
+	* @return The linear model, accumulated in double, see accumulateLinearSufficientStats.
+	* @throw DifferentNoOfRows If the abcissa and the ordinate have different numbers of rows.
+	*/
+	template <typename T>
+	LinearModel fitLinearModel(Core::BasicColumnView<T> abcissa, Core::BasicColumnView<T> ordinate) {
+		checkNoOfRows(abcissa, ordinate);
+		return accumulate(abcissa.data(), ordinate.data(), abcissa.getNoOfRows()).fit();
+	}
+
+	/**
+	* @brief Get the sufficient statistics of the contiguous float, int32_t or int64_t data points by the chunked reduction.
+	* @param abcissa The contiguous abcissa values of the data points.
+	* @param ordinate The contiguous ordinate values of the data points.
+	* @param noOfPoints The number of data points.
+	* @return The statistics accumulated in double, bitwise identical for any number of threads and any instruction set.
+	*/
+	template <typename T>
+	LinearSufficientStats accumulate(const T* abcissa, const T* ordinate, size_t noOfPoints) const;
+
+	/**
+	* @brief Fits a linear model to the selected rows of the columns, without materializing the selections.
+	* @param abcissa The selected abcissa values of the data points.
+	* @param ordinate The selected ordinate values of the data points, selected by the same number of rows.
+	* @return The linear model, bitwise identical to the fit of the materialized selections.
+	* @throw DifferentNoOfRows If the selections have different numbers of rows.
+	*/
+	LinearModel fitLinearModel(const Core::ColumnSelection& abcissa, const Core::ColumnSelection& ordinate);
+
+	/**
+	* @brief Get the sufficient statistics of the selected data points by the chunked reduction.
+	* @param abcissa The selected abcissa values of the data points.
+	* @param ordinate The selected ordinate values of the data points.
+	* @return The statistics, bitwise identical to the ones of the materialized selections.
+	* @note Each chunk is gathered into a buffer of one chunk per worker thread, reused for all its chunks.
+	* @throw DifferentNoOfRows If the selections have different numbers of rows.
+	*/
+	LinearSufficientStats accumulate(const Core::ColumnSelection& abcissa, const Core::ColumnSelection& ordinate) const;
+
+private:
+	/**
+	* @brief The worker threads, empty for the serial accumulation.
+	*/
+	std::shared_ptr<Core::ThreadPool> _pThreadPool;
 };
 
 } // namespace Fitting
@@ -0,0 +1,86 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "CpuFeatures.h"
+#include "LinearSufficientStats.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+/**
+* @brief Get the least squares sufficient statistics of the data points in one pass over the contiguous values.
+* @param abcissa The contiguous abcissa values of the data points.
+* @param ordinate The contiguous ordinate values of the data points.
+* @param noOfPoints The number of data points.
+* @return The statistics of the data points.
+* @note The sums of the deviations from the first data point and of their products are accumulated
+* with the Kahan compensation in eight lanes, the co-moments are centred once at the end.
+* The kernel of the fastest instruction set supported by the running CPU is used. Every kernel keeps the same
+* eight lanes and adds them in the same order, so the statistics are bitwise identical on every instruction set.
+*/
+LinearSufficientStats accumulateLinearSufficientStats(const double* abcissa, const double* ordinate, size_t noOfPoints);
+
+/**
+* @brief Get the least squares sufficient statistics with the kernel of the given instruction set.
+* @param instructionSet The instruction set, it has to be supported by the running CPU.
+* @see accumulateLinearSufficientStats for the other parameters.
+*/
+LinearSufficientStats accumulateLinearSufficientStats(
+	Core::InstructionSet instructionSet, const double* abcissa, const double* ordinate, size_t noOfPoints);
+
+/**
+* @brief Get the least squares sufficient statistics of the data points in two scalar passes,
+* the running means first and the sums of the products of the deviations from them second.
+* @param abcissa The contiguous abcissa values of the data points.
+* @param ordinate The contiguous ordinate values of the data points.
+* @param noOfPoints The number of data points.
+* @return The statistics of the data points, accumulated in double.
+* @note The order of the operations does not depend on the instruction set, it is the one of the least squares fit
+* before the fused kernel. The supported types of the values are double, float, int32_t and int64_t,
+* the deviations of the int64_t values are taken from the first data point in the integers, as in the kernels.
+*/
+template <typename T>
+LinearSufficientStats accumulateLinearSufficientStatsInTwoPasses(const T* abcissa, const T* ordinate, size_t noOfPoints);
+
+/**
+* @brief Get the least squares sufficient statistics of the data points stored as float, int32_t or int64_t values.
+* @param abcissa The contiguous abcissa values of the data points.
+* @param ordinate The contiguous ordinate values of the data points.
+* @param noOfPoints The number of data points.
+* @return The statistics of the data points, accumulated in double.
+* @note The values are converted to double as they are loaded, so the float data are read at half the bandwidth
+* of the double ones. The float and int32_t statistics are bitwise identical to the ones of the same values
+* converted to double. The deviations of the int64_t values from the first data point are taken in the integers,
+* so large values, e.g. timestamps, keep the digits of their differences.
+*/
+template <typename T>
+LinearSufficientStats accumulateLinearSufficientStats(const T* abcissa, const T* ordinate, size_t noOfPoints);
+
+/**
+* @brief Get the least squares sufficient statistics of the float, int32_t or int64_t values with the kernel of the given instruction set.
+* @param instructionSet The instruction set, it has to be supported by the running CPU.
+* @see accumulateLinearSufficientStats for the other parameters.
+*/
+template <typename T>
+LinearSufficientStats accumulateLinearSufficientStats(
+	Core::InstructionSet instructionSet, const T* abcissa, const T* ordinate, size_t noOfPoints);
+
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
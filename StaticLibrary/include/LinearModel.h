@@ -13,6 +13,8 @@
 
 #pragma once
 
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include "Column.h"
 using namespace std;
@@ -107,20 +109,59 @@ class LinearModel {
 		* @brief Get the value of the linear model at a given abcissa.
 		* @param abcissa The abcissa value.
 		*/
-		double getValueAt(const double& abcissa);
+		double getValueAt(const double& abcissa) const;
 
 		/**
 		* @brief Get the values of the linear model at multiple abcisses.
 		* @param abcisses The vector of abcisses.
 		*/
-		vector<double> getMultipleValuesAt(const vector<double>& abcisses);
+		vector<double> getMultipleValuesAt(const vector<double>& abcisses) const;
 
 		/**
 		* @brief Get the sum of squared residuals for the set of data points against the linear model.
 		* @param abcissa The abcissa values.
 		* @param ordinate The ordinate values.
+		* @throw DifferentNoOfRows If the abcissa and the ordinate have different numbers of rows.
 		*/
-		double sumOfSquaredResiduals(const Column& abcissa, const Column& ordinate);
+		double sumOfSquaredResiduals(const Column& abcissa, const Column& ordinate) const;
+
+		/**
+		* @brief Evaluate the linear model at multiple abcisses into a caller-provided buffer, without allocation.
+		* @param abcisses The contiguous abcissa values.
+		* @param noOfPoints The number of abcissa values.
+		* @param values The output array of noOfPoints model values.
+		*/
+		void evaluate(const double* abcisses, size_t noOfPoints, double* values) const;
+
+		/**
+		* @brief Get the residuals (model value - ordinate) of the data points into a caller-provided buffer, without allocation.
+		* @param abcissa The contiguous abcissa values of the data points.
+		* @param ordinate The contiguous ordinate values of the data points.
+		* @param noOfPoints The number of data points.
+		* @param residuals The output array of noOfPoints residuals.
+		*/
+		void residuals(const double* abcissa, const double* ordinate, size_t noOfPoints, double* residuals) const;
+
+		/**
+		* @brief Get the sum of squared residuals of the contiguous data points, without allocation.
+		* @param abcissa The contiguous abcissa values of the data points.
+		* @param ordinate The contiguous ordinate values of the data points.
+		* @param noOfPoints The number of data points.
+		* @return The sum of squared residuals.
+		* @note The squares are summed in four interleaved partial sums, so the loop vectorizes and the rounding may differ from a sequential sum.
+		*/
+		double sumOfSquaredResiduals(const double* abcissa, const double* ordinate, size_t noOfPoints) const;
+
+		/**
+		* @class DifferentNoOfRows
+		* @brief Exception for the abcissa and the ordinate of different numbers of rows, thrown by the model and the fit strategies.
+		* @note It is an std::out_of_range, as the one thrown by the reading of the rows missing in the shorter column.
+		*/
+		class DifferentNoOfRows : public std::out_of_range {
+			public:
+				explicit DifferentNoOfRows(const std::string& message)
+					: std::out_of_range(message) {}
+		};
 
 private:
 		/**
@@ -0,0 +1,178 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "LinearModel.h"
+
+#include <cstddef>
+
+using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+/**
+* @class LinearSufficientStats
+* @brief The sufficient statistics of the least squares line of a set of data points.
+*
+* The statistics are the number of points, the means and the central co-moments
+* (the sums of the products of the deviations from the means), updated by the Welford
+* recurrences and merged by the Chan et al. formulas, so a large offset of the data
+* does not cancel the digits of the slope as the raw sums of x * x and x * y would.
+*
+* Features:
+* - Add and remove a data point in O(1).
+* - Merge the statistics of another set of data points in O(1).
+* - Fit the least squares line and get its sum of squared residuals without reading the data points again.
+*
+* @see T. F. Chan, G. H. Golub, R. J. LeVeque, Algorithms for Computing the Sample Variance, 1983.
+*/
+class LinearSufficientStats {
+  public:
+	/**
+	* @brief Constructor of the statistics of no data points.
+	*/
+	LinearSufficientStats() = default;
+
+	/**
+	* @brief Get the statistics from the means and the central co-moments computed by the caller, e.g. in two passes.
+	* @param noOfPoints The number of data points.
+	* @param abcissaMean The mean of the abcissa values.
+	* @param ordinateMean The mean of the ordinate values.
+	* @param abcissaComoment The sum of the squared deviations of the abcissa values from their mean.
+	* @param crossComoment The sum of the products of the deviations of the abcissa and the ordinate values from their means.
+	* @param ordinateComoment The sum of the squared deviations of the ordinate values from their mean.
+	* @return The statistics.
+	*/
+	static LinearSufficientStats fromCentralMoments(
+		size_t noOfPoints, double abcissaMean, double ordinateMean,
+		double abcissaComoment, double crossComoment, double ordinateComoment)
+	{
+		LinearSufficientStats stats;
+		stats._noOfPoints = noOfPoints;
+		stats._abcissaMean = abcissaMean;
+		stats._ordinateMean = ordinateMean;
+		stats._abcissaComoment = abcissaComoment;
+		stats._crossComoment = crossComoment;
+		stats._ordinateComoment = ordinateComoment;
+		return stats;
+	}
+
+	/**
+	* @brief Add a data point.
+	* @param abcissa The abcissa value of the data point.
+	* @param ordinate The ordinate value of the data point.
+	*/
+	void add(double abcissa, double ordinate) {
+		_noOfPoints++;
+		double count = static_cast<double>(_noOfPoints);
+		double abcissaDeviation = abcissa - _abcissaMean;
+		double ordinateDeviation = ordinate - _ordinateMean;
+		_abcissaMean += abcissaDeviation / count;
+		_ordinateMean += ordinateDeviation / count;
+		_abcissaComoment += abcissaDeviation * (abcissa - _abcissaMean);
+		_crossComoment += abcissaDeviation * (ordinate - _ordinateMean);
+		_ordinateComoment += ordinateDeviation * (ordinate - _ordinateMean);
+	}
+
+	/**
+	* @brief Remove a data point added before.
+	* @param abcissa The abcissa value of the data point.
+	* @param ordinate The ordinate value of the data point.
+	*/
+	void remove(double abcissa, double ordinate);
+
+	/**
+	* @brief Merge the statistics of another set of data points.
+	* @param other The statistics of the other set.
+	*/
+	void merge(const LinearSufficientStats& other);
+
+	/**
+	* @brief Get the number of data points.
+	*/
+	size_t getNoOfPoints() const { return _noOfPoints; }
+
+	/**
+	* @brief Get the mean of the abcissa values.
+	*/
+	double getAbcissaMean() const { return _abcissaMean; }
+
+	/**
+	* @brief Get the mean of the ordinate values.
+	*/
+	double getOrdinateMean() const { return _ordinateMean; }
+
+	/**
+	* @brief Get the sum of the squared deviations of the abcissa values from their mean.
+	*/
+	double getAbcissaComoment() const { return _abcissaComoment; }
+
+	/**
+	* @brief Get the sum of the products of the deviations of the abcissa and the ordinate values from their means.
+	*/
+	double getCrossComoment() const { return _crossComoment; }
+
+	/**
+	* @brief Get the sum of the squared deviations of the ordinate values from their mean.
+	*/
+	double getOrdinateComoment() const { return _ordinateComoment; }
+
+	/**
+	* @brief Fit the least squares line to the data points.
+	* @return The least squares line, its slope is not finite if all the abcissa values are equal.
+	*/
+	LinearModel fit() const;
+
+	/**
+	* @brief Get the sum of squared residuals of the least squares line.
+	* @return The sum of squared residuals, the one of the mean ordinate if all the abcissa values are equal.
+	*/
+	double getSumOfSquaredResiduals() const;
+
+  private:
+	/**
+	* @brief The number of data points.
+	*/
+	size_t _noOfPoints = 0;
+
+	/**
+	* @brief The mean of the abcissa values.
+	*/
+	double _abcissaMean = 0.0;
+
+	/**
+	* @brief The mean of the ordinate values.
+	*/
+	double _ordinateMean = 0.0;
+
+	/**
+	* @brief The sum of the squared deviations of the abcissa values.
+	*/
+	double _abcissaComoment = 0.0;
+
+	/**
+	* @brief The sum of the products of the deviations of the abcissa and the ordinate values.
+	*/
+	double _crossComoment = 0.0;
+
+	/**
+	* @brief The sum of the squared deviations of the ordinate values.
+	*/
+	double _ordinateComoment = 0.0;
+};
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
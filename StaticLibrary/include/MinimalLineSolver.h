@@ -0,0 +1,68 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "LinearModel.h"
+
+#include <cmath>
+
+using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+/**
+* @class MinimalLineSolver
+* @brief The solver of the line passing through a minimal sample of two data points.
+*
+* The line is computed directly from the two points, no column is built and
+* no memory is allocated, so the solver is cheap enough for the RANSAC sampling loop.
+*/
+class MinimalLineSolver {
+  public:
+	/**
+	* @brief The number of data points needed to determine a line.
+	*/
+	static constexpr size_t sampleSize = 2;
+
+	/**
+	* @brief Fits the line through two data points.
+	* @param firstAbcissa The abcissa of the first point.
+	* @param firstOrdinate The ordinate of the first point.
+	* @param secondAbcissa The abcissa of the second point.
+	* @param secondOrdinate The ordinate of the second point.
+	* @param model The line through both points, left untouched for a degenerate sample.
+	* @return False if the sample is degenerate (identical abcissas), true otherwise.
+	*/
+	static bool solve(
+		const double firstAbcissa, const double firstOrdinate,
+		const double secondAbcissa, const double secondOrdinate,
+		LinearModel& model)
+	{
+		double abcissaDifference = secondAbcissa - firstAbcissa;
+		if (abcissaDifference == 0.0) {
+			return false;
+		}
+		double slope = (secondOrdinate - firstOrdinate) / abcissaDifference;
+		if (!std::isfinite(slope)) {
+			return false;
+		}
+		model.setSlope(slope);
+		model.setYIntercept(firstOrdinate - slope * firstAbcissa);
+		return true;
+	}
+};
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
@@ -0,0 +1,182 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Core {
+
+/**
+* @class PhiloxRandomGenerator
+* @brief The counter-based Philox4x32-10 random number generator.
+*
+* The output is a pure function of the key (the seed) and the counter (the stream and the position in it),
+* so the numbers of any stream can be reproduced without generating the streams before it.
+* RANSAC uses the iteration index as the stream, so an iteration draws the same sample
+* whichever thread runs it.
+*
+* @see J. K. Salmon et al., Parallel Random Numbers: As Easy as 1, 2, 3, SC 2011.
+*/
+class PhiloxRandomGenerator {
+  public:
+	/**
+	* @brief The type of the generated numbers, the class satisfies the UniformRandomBitGenerator requirements.
+	*/
+	using result_type = uint32_t;
+
+	/**
+	* @brief Constructor for the PhiloxRandomGenerator class.
+	* @param seed The key of the generator.
+	* @param stream The index of the stream, the different streams of one seed are independent.
+	*/
+	PhiloxRandomGenerator(uint64_t seed, uint64_t stream)
+		: _key{ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) },
+		  _counter{ static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32), 0, 0 },
+		  _output{}, _outputPosition{ blockSize }
+	{}
+
+	/**
+	* @brief Get the smallest value the generator returns.
+	*/
+	static constexpr result_type min() { return 0; }
+
+	/**
+	* @brief Get the largest value the generator returns.
+	*/
+	static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+	/**
+	* @brief Get the next 32 random bits of the stream.
+	*/
+	result_type operator()() {
+		if (_outputPosition == blockSize) {
+			_output = generateBlock(_counter, _key);
+			_outputPosition = 0;
+			// the block position is the upper half of the counter
+			if (++_counter[2] == 0) {
+				++_counter[3];
+			}
+		}
+		return _output[_outputPosition++];
+	}
+
+	/**
+	* @brief Get the next 64 random bits of the stream.
+	*/
+	uint64_t nextUInt64() {
+		uint64_t low = (*this)();
+		uint64_t high = (*this)();
+		return (high << 32) | low;
+	}
+
+	/**
+	* @brief Get a uniformly distributed index from the range [0, bound).
+	* @param bound The number of the indexes, greater than 0.
+	* @return The random index.
+	*/
+	uint64_t uniformIndex(uint64_t bound) {
+		// the values below the threshold would make the lowest indexes more likely
+		uint64_t threshold = (0 - bound) % bound;
+		uint64_t value = nextUInt64();
+		while (value < threshold) {
+			value = nextUInt64();
+		}
+		return value % bound;
+	}
+
+	/**
+	* @brief Generate one block of the Philox4x32-10 output.
+	* @param counter The counter of the block.
+	* @param key The key.
+	* @return The four 32-bit random numbers.
+	*/
+	static std::array<uint32_t, 4> generateBlock(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+		for (int round = 0; round < numberOfRounds; round++) {
+			if (round > 0) {
+				key[0] += keyIncrement0;
+				key[1] += keyIncrement1;
+			}
+			uint64_t product0 = static_cast<uint64_t>(multiplier0) * counter[0];
+			uint64_t product1 = static_cast<uint64_t>(multiplier1) * counter[2];
+			counter = {
+				static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+				static_cast<uint32_t>(product1),
+				static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+				static_cast<uint32_t>(product0)
+			};
+		}
+		return counter;
+	}
+
+  private:
+	static constexpr size_t blockSize = 4;
+	static constexpr int numberOfRounds = 10;
+	static constexpr uint32_t multiplier0 = 0xD2511F53;
+	static constexpr uint32_t multiplier1 = 0xCD9E8D57;
+	static constexpr uint32_t keyIncrement0 = 0x9E3779B9;
+	static constexpr uint32_t keyIncrement1 = 0xBB67AE85;
+
+	/**
+	* @brief The key, i.e. the seed.
+	*/
+	std::array<uint32_t, 2> _key;
+
+	/**
+	* @brief The counter of the next block, the stream in the lower half and the block in the upper half.
+	*/
+	std::array<uint32_t, 4> _counter;
+
+	/**
+	* @brief The current block of the output.
+	*/
+	std::array<uint32_t, 4> _output;
+
+	/**
+	* @brief The position of the next number in the current block.
+	*/
+	size_t _outputPosition;
+};
+
+/**
+* @brief Select distinct indexes from the range [0, noOfRows) randomly by Floyd's algorithm.
+* @param generator The random number generator.
+* @param noOfRows The total number of indexes, at least sampleSize.
+* @param sampleSize The number of indexes to be selected.
+* @param selectedIndexes The output array of sampleSize indexes.
+* @note One uniform index is drawn per selected index, a taken candidate is replaced without a redraw. The number of
+* random numbers consumed is not fixed, uniformIndex rejects the 64 bit values below its threshold, which are fewer than
+* noOfRows out of 2^64. There is no sort and no allocation.
+*/
+inline void sampleIndexesWithoutReplacement(
+	PhiloxRandomGenerator& generator, size_t noOfRows, size_t sampleSize, size_t* selectedIndexes)
+{
+	for (size_t selected = 0, candidateRange = noOfRows - sampleSize; selected < sampleSize; selected++, candidateRange++) {
+		size_t candidate = static_cast<size_t>(generator.uniformIndex(static_cast<uint64_t>(candidateRange) + 1));
+		for (size_t previous = 0; previous < selected; previous++) {
+			if (selectedIndexes[previous] == candidate) {
+				// the candidate is taken, the top of the range cannot have been selected yet
+				candidate = candidateRange;
+				break;
+			}
+		}
+		selectedIndexes[selected] = candidate;
+	}
+}
+
+} // namespace Core
+} // namespace ConsoleAppRansacIINamespace
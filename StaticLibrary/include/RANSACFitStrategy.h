@@ -13,7 +13,16 @@
 
 #pragma once
 
+#include "CancellationToken.h"
 #include "ILinearModelFitStrategy.h"
+#include "InlierMask.h"
+#include "ThreadPool.h"
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
 
 using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
 using Column = ConsoleAppRansacIINamespace::Core::Column;   
@@ -21,6 +30,30 @@ using Column = ConsoleAppRansacIINamespace::Core::Column;
 namespace ConsoleAppRansacIINamespace {
 namespace Fitting {	
 
+struct RansacEngineSettings;
+struct RansacEngineResult;
+
+/**
+* @enum RANSACScoring
+* @brief The loss the RANSAC hypotheses are ranked by.
+*/
+enum class RANSACScoring {
+	/**
+	* @brief The sum of squared residuals of the least squares refit to the consensus set.
+	*/
+	ResidualSum,
+
+	/**
+	* @brief The MSAC truncated quadratic loss, an outlier costs the squared threshold.
+	*/
+	MSAC,
+
+	/**
+	* @brief The MLESAC negative log-likelihood of the gaussian inliers and the uniform outliers.
+	*/
+	MLESAC
+};
+
 /**
 * @class RANSACParameters
 * @brief The parameters for the RANSAC algorithm.
@@ -47,6 +80,61 @@ private:
 	*/
 	int numberOfInliersToWellFit;
 
+	/**
+	* @brief The number of threads evaluating the hypotheses, 1 means serial, 0 means one per hardware thread.
+	*/
+	int numberOfThreads;
+
+	/**
+	* @brief The probability of drawing at least one outlier-free sample, 0 disables the adaptive iteration count.
+	*/
+	double targetConfidence;
+
+	/**
+	* @brief The seed of the random samples, drawn from std::random_device per fit when not set.
+	*/
+	uint64_t randomSeed;
+
+	/**
+	* @brief True if the seed was set, so the fits are reproducible.
+	*/
+	bool randomSeedSet;
+
+	/**
+	* @brief The number of data points scored per round of the preemptive scoring, 0 disables the preemptive scoring.
+	*/
+	size_t preemptiveBlockSize;
+
+	/**
+	* @brief The fraction of the hypotheses kept after each round of the preemptive scoring.
+	*/
+	double preemptiveKeptFraction;
+
+	/**
+	* @brief The probability of a data point being an inlier of a bad hypothesis, 0 disables the SPRT verification.
+	*/
+	double sprtBadModelInlierRatio;
+
+	/**
+	* @brief The maximal number of refit and re-threshold steps of the local optimization, 0 disables the local optimization.
+	*/
+	int localOptimizationSteps;
+
+	/**
+	* @brief The wall-clock time a fit may take, 0 means no limit.
+	*/
+	std::chrono::microseconds timeBudget;
+
+	/**
+	* @brief The number of hypotheses scored together in one sweep over the data points, 0 scores them one by one.
+	*/
+	size_t hypothesisBatchSize;
+
+	/**
+	* @brief The loss the hypotheses are ranked by.
+	*/
+	RANSACScoring scoring;
+
 public:
 	/**
 	* @brief Constructor.
@@ -63,7 +151,18 @@ public:
 		numberOfIterations{ maxIt },
 		numberOfRandomSelectedPoints{ minPointsToEstimate },
 		tresholdValueToBeInlier{ inlierThreshold },
-		numberOfInliersToWellFit{ numOfInliers }
+		numberOfInliersToWellFit{ numOfInliers },
+		numberOfThreads{ 1 },
+		targetConfidence{ 0.0 },
+		randomSeed{ 0 },
+		randomSeedSet{ false },
+		preemptiveBlockSize{ 0 },
+		preemptiveKeptFraction{ 0.5 },
+		sprtBadModelInlierRatio{ 0.0 },
+		localOptimizationSteps{ 0 },
+		timeBudget{ 0 },
+		hypothesisBatchSize{ 0 },
+		scoring{ RANSACScoring::ResidualSum }
 	{}
 
 	/**
@@ -97,30 +196,423 @@ public:
 	int getNumberOfInliersToWellFit() const {
 		return numberOfInliersToWellFit;
 	}
+
+	/**
+	* @brief Gets the number of threads evaluating the hypotheses.
+	* @return The number of threads, 1 means serial, 0 means one per hardware thread.
+	*/
+	int getNumberOfThreads() const {
+		return numberOfThreads;
+	}
+
+	/**
+	* @brief Sets the number of threads evaluating the hypotheses.
+	* @param threads The number of threads, 1 means serial, 0 means one per hardware thread.
+	*/
+	void setNumberOfThreads(const int& threads) {
+		numberOfThreads = threads;
+	}
+
+	/**
+	* @brief Gets the target confidence of the adaptive iteration count.
+	* @return The target confidence, 0 when the number of iterations is fixed.
+	*/
+	double getTargetConfidence() const {
+		return targetConfidence;
+	}
+
+	/**
+	* @brief Sets the target confidence of the adaptive iteration count.
+	* @param confidence The probability (e.g. 0.99) of drawing at least one outlier-free sample.
+	* @note The number of iterations then becomes the upper bound of the adaptive iteration count.
+	*/
+	void setTargetConfidence(const double& confidence) {
+		targetConfidence = confidence;
+	}
+
+	/**
+	* @brief Checks if the number of iterations is adapted to the inlier ratio.
+	* @return True if the target confidence is set.
+	*/
+	bool isAdaptive() const {
+		return targetConfidence > 0.0;
+	}
+
+	/**
+	* @brief Gets the seed of the random samples.
+	* @return The seed, meaningful only if it was set.
+	*/
+	uint64_t getRandomSeed() const {
+		return randomSeed;
+	}
+
+	/**
+	* @brief Sets the seed of the random samples, the fits of the same data then draw the same samples.
+	* @param seed The seed, e.g. RANSACFitReport::randomSeed of the fit to be replayed.
+	*/
+	void setRandomSeed(const uint64_t& seed) {
+		randomSeed = seed;
+		randomSeedSet = true;
+	}
+
+	/**
+	* @brief Checks if the seed of the random samples was set.
+	* @return True if the seed was set, false if every fit draws a fresh one.
+	*/
+	bool hasRandomSeed() const {
+		return randomSeedSet;
+	}
+
+	/**
+	* @brief Gets the number of data points scored per round of the preemptive scoring.
+	* @return The block size, 0 when the preemptive scoring is disabled.
+	*/
+	size_t getPreemptiveBlockSize() const {
+		return preemptiveBlockSize;
+	}
+
+	/**
+	* @brief Gets the fraction of the hypotheses kept after each round of the preemptive scoring.
+	* @return The kept fraction.
+	*/
+	double getPreemptiveKeptFraction() const {
+		return preemptiveKeptFraction;
+	}
+
+	/**
+	* @brief Enables the preemptive scoring, all the hypotheses are generated up front and scored breadth-first.
+	* @param blockSize The number of data points scored per round, 0 disables the preemptive scoring.
+	* @param keptFraction The fraction (0, 1) of the hypotheses kept after each round.
+	* @note The number of iterations is the number of hypotheses, the target confidence is not used.
+	*/
+	void setPreemptiveScoring(const size_t& blockSize, const double& keptFraction = 0.5) {
+		preemptiveBlockSize = blockSize;
+		preemptiveKeptFraction = keptFraction;
+	}
+
+	/**
+	* @brief Checks if the hypotheses are scored preemptively.
+	* @return True if the preemptive block size is set.
+	*/
+	bool isPreemptive() const {
+		return preemptiveBlockSize > 0;
+	}
+
+	/**
+	* @brief Gets the probability of a data point being an inlier of a bad hypothesis.
+	* @return The inlier ratio of a bad hypothesis, 0 when the SPRT verification is disabled.
+	*/
+	double getSprtBadModelInlierRatio() const {
+		return sprtBadModelInlierRatio;
+	}
+
+	/**
+	* @brief Enables the verification of the hypotheses by Wald's sequential probability ratio test (SPRT).
+	* @param badModelInlierRatio The probability (e.g. 0.05) of a data point being an inlier of a bad hypothesis, 0 disables the SPRT.
+	* @note The SPRT is not used by the preemptive scoring.
+	*/
+	void setSprtVerification(const double& badModelInlierRatio) {
+		sprtBadModelInlierRatio = badModelInlierRatio;
+	}
+
+	/**
+	* @brief Checks if the hypotheses are verified by the SPRT.
+	* @return True if the inlier ratio of a bad hypothesis is set.
+	*/
+	bool isSprtVerified() const {
+		return sprtBadModelInlierRatio > 0.0;
+	}
+
+	/**
+	* @brief Gets the maximal number of steps of the local optimization.
+	* @return The number of steps, 0 when the local optimization is disabled.
+	*/
+	int getLocalOptimizationSteps() const {
+		return localOptimizationSteps;
+	}
+
+	/**
+	* @brief Enables the local optimization (LO-RANSAC) of the hypotheses with the most inliers so far.
+	* @param steps The maximal number of refit and re-threshold steps, 0 disables the local optimization.
+	* @note The hypotheses are then ranked by the number of inliers and the sum of squared residuals breaks the ties.
+	*/
+	void setLocalOptimization(const int& steps) {
+		localOptimizationSteps = steps;
+	}
+
+	/**
+	* @brief Checks if the best hypotheses are locally optimized.
+	* @return True if the number of the local optimization steps is set.
+	*/
+	bool isLocallyOptimized() const {
+		return localOptimizationSteps > 0;
+	}
+
+	/**
+	* @brief Gets the wall-clock time a fit may take.
+	* @return The time budget, 0 when the time is not limited.
+	*/
+	std::chrono::microseconds getTimeBudget() const {
+		return timeBudget;
+	}
+
+	/**
+	* @brief Sets the wall-clock time a fit may take, the fit then returns the best model found before the deadline.
+	* @param budget The time budget counted from the start of the fit, 0 means no limit.
+	*/
+	void setTimeBudget(const std::chrono::microseconds& budget) {
+		timeBudget = budget;
+	}
+
+	/**
+	* @brief Checks if the wall-clock time of a fit is limited.
+	* @return True if the time budget is set.
+	*/
+	bool hasTimeBudget() const {
+		return timeBudget.count() > 0;
+	}
+
+	/**
+	* @brief Gets the number of hypotheses scored together in one sweep over the data points.
+	* @return The batch size, 0 when the hypotheses are scored one by one.
+	*/
+	size_t getHypothesisBatchSize() const {
+		return hypothesisBatchSize;
+	}
+
+	/**
+	* @brief Enables the batched evaluation, the hypotheses of a batch are counted together tile by tile.
+	* @param batchSize The number of hypotheses in a batch (e.g. 64), 0 scores the hypotheses one by one.
+	* @note It pays off when the data points do not fit in the cache. The SPRT is not used by the batched evaluation.
+	*/
+	void setBatchedEvaluation(const size_t& batchSize) {
+		hypothesisBatchSize = batchSize;
+	}
+
+	/**
+	* @brief Checks if the hypotheses are scored in batches.
+	* @return True if the batch size is set.
+	*/
+	bool isBatched() const {
+		return hypothesisBatchSize > 0;
+	}
+
+	/**
+	* @brief Gets the loss the hypotheses are ranked by.
+	* @return The scoring.
+	*/
+	RANSACScoring getScoring() const {
+		return scoring;
+	}
+
+	/**
+	* @brief Sets the loss the hypotheses are ranked by.
+	* @param newScoring The scoring. MSAC and MLESAC score every hypothesis in the pass counting its inliers,
+	* and only the hypotheses scoring better than the best one so far are refined.
+	*/
+	void setScoring(const RANSACScoring& newScoring) {
+		scoring = newScoring;
+	}
+};
+
+/**
+* @struct RANSACFitReport
+* @brief The outcome of a RANSAC fit, the model together with the consensus set it was refined on.
+*/
+struct RANSACFitReport {
+	/**
+	* @brief The fitted linear model.
+	*/
+	LinearModel model;
+
+	/**
+	* @brief The consensus set of the best hypothesis, the model is refined on these data points.
+	*/
+	InlierMask inlierMask;
+
+	/**
+	* @brief The number of inliers in the consensus set.
+	*/
+	size_t numberOfInliers = 0;
+
+	/**
+	* @brief The sum of squared residuals of the model over the consensus set.
+	*/
+	double sumOfSquaredResiduals = std::numeric_limits<double>::max();
+
+	/**
+	* @brief The number of evaluated hypotheses.
+	*/
+	size_t numberOfIterations = 0;
+
+	/**
+	* @brief The seed the samples were drawn with, setting it in the parameters replays the fit.
+	*/
+	uint64_t randomSeed = 0;
+
+	/**
+	* @brief The number of hypotheses rejected by the SPRT before all the data points were verified.
+	*/
+	size_t numberOfRejectedHypotheses = 0;
+
+	/**
+	* @brief The number of hypotheses that set a new best number of inliers and were locally optimized.
+	*/
+	size_t numberOfLocalOptimizations = 0;
+
+	/**
+	* @brief True if the fit was stopped by the time budget or the cancellation token before all its iterations.
+	*/
+	bool interrupted = false;
+
+	/**
+	* @brief True if the adaptive fit ran enough iterations to draw an outlier-free sample with the target confidence.
+	*/
+	bool confidenceReached = false;
+
+	/**
+	* @brief True if a hypothesis had enough inliers to be well fit, false if the model is the default one.
+	*/
+	bool modelFound = false;
 };
 
 /**
 * @class RANSACFitStrategy
 * @brief The RANSAC fitting algorithm/strategy for a linear model to a set of data points using the RANSAC method.
+*
+* The strategy is a thin wrapper of RansacEngine, it fetches the data points from the columns once
+* and picks the policies of the engine from the parameters.
+*
+* The sample of an iteration is drawn from the counter-based generator keyed by the seed and the iteration index,
+* so a fixed number of iterations gives the same result for any number of threads.
+* The adaptive iteration count may let the parallel fit evaluate a few more iterations than the serial one.
+*
+* The preemptive scoring bounds the work of a fit regardless of the outlier ratio:
+* all the hypotheses are scored on a block of the shuffled data points, the best fraction of them is kept
+* and scored on the next block, until one hypothesis is left or the data points run out.
+*
+* The SPRT verification scores a hypothesis on the shuffled data points block by block and rejects it
+* as soon as it is unlikely to have as many inliers as the best hypothesis so far.
+* Which hypotheses are rejected then depends on the order the threads find the best ones in.
+*
+* The local optimization refits and re-thresholds only the hypotheses with more inliers than the best one so far,
+* so the refinement runs a few times per fit instead of once per well fit hypothesis.
+*
+* The batched evaluation generates a batch of hypotheses and counts their inliers in one sweep over
+* cache-sized tiles of the data points, only the well fit hypotheses are then scored one by one.
+*
+* The MSAC and MLESAC scorings sum the squared residuals of the inliers in the pass counting them,
+* so every hypothesis is ranked by the truncated loss at no extra pass, and only the new best ones are refined.
+* The hypotheses near the true line are told apart by their residuals and not only by their inlier counts.
+*
+* The sequential fit of several lines runs one search per line on the data points not claimed yet.
+* The unclaimed points are compacted in place in the buffers fetched once from the columns,
+* so the later searches sample and score only them, and the inlier masks are mapped back to the rows of the columns.
+*
+* A fit with a time budget or a cancellation token is anytime: it checks them between the iterations
+* and returns the best model found so far, flagged as interrupted.
+*
+* @see D. Nister, Preemptive RANSAC for Live Structure and Motion Estimation, ICCV 2003.
+* @see J. Matas, O. Chum, Randomized RANSAC with Sequential Probability Ratio Test, ICCV 2005.
+* @see O. Chum, J. Matas, J. Kittler, Locally Optimized RANSAC, DAGM 2003.
+* @see P. H. S. Torr, A. Zisserman, MLESAC: A New Robust Estimator with Application to Estimating Image Geometry, CVIU 2000.
 */
 class RANSACFitStrategy : public ILinearModelFitStrategy {
 public:
 	/**
+	* @brief Constructor.
+	* @param ransacParameters The parameters of the RANSAC algorithm.
+	* @note The worker threads are started here when more than one thread is requested.
+	*/
+	RANSACFitStrategy(const RANSACParameters& ransacParameters = RANSACParameters{});
+
+	/**
+	* @brief Gets the parameters of the RANSAC algorithm.
+	* @return The parameters.
+	*/
+	const RANSACParameters& getParameters() const {
+		return _parameters;
+	}
+
+	/**
     * @brief Fits a linear model to a set of data points using the RANSAC algorithm.
     * @param abcissa The abcissa values of the data points.
     * @param ordinate The ordinate values of the data points.
 	* @return The linear model that fits the (abcissa,ordinate).
     */
-    virtual LinearModel fitLinearModel(const Column& abcissa, const Column& ordinate) override;
+    virtual LinearModel fitLinearModel(ColumnView abcissa, ColumnView ordinate) override;
+
+	/**
+	* @brief Fits a linear model to a set of data points using the RANSAC algorithm and reports the consensus set.
+	* @param abcissa The abcissa values of the data points.
+	* @param ordinate The ordinate values of the data points.
+	* @return The linear model with its inlier mask, so the callers do not have to classify the points again.
+	* @throw DifferentNoOfRows If the abcissa and the ordinate have different numbers of rows.
+	*/
+	RANSACFitReport fitLinearModelWithReport(ColumnView abcissa, ColumnView ordinate);
+
+	/**
+	* @brief Fits a linear model to a set of data points using the RANSAC algorithm until it finishes or is cancelled.
+	* @param abcissa The abcissa values of the data points.
+	* @param ordinate The ordinate values of the data points.
+	* @param cancellationToken The token polled between the iterations.
+	* @return The best model found before the cancellation, RANSACFitReport::interrupted tells if the fit was cut short.
+	*/
+	RANSACFitReport fitLinearModelWithReport(ColumnView abcissa, ColumnView ordinate, const Core::CancellationToken& cancellationToken);
+
+	/**
+	* @brief Extracts up to the given number of lines one after another, each from the data points not claimed by the previous ones.
+	* @param abcissa The abcissa values of the data points.
+	* @param ordinate The ordinate values of the data points.
+	* @param maxNumberOfModels The maximal number of lines.
+	* @return The reports of the lines in the order of their extraction, the inlier masks are over all the data points.
+	* @note The extraction stops early when no line has enough inliers among the unclaimed points.
+	* @throw DifferentNoOfRows If the abcissa and the ordinate have different numbers of rows.
+	*/
+	std::vector<RANSACFitReport> fitLinearModels(ColumnView abcissa, ColumnView ordinate, size_t maxNumberOfModels);
+
+	/**
+	* @brief Extracts up to the given number of lines until it finishes or is cancelled.
+	* @param cancellationToken The token polled between the iterations, the lines extracted before the cancellation are returned.
+	* @see fitLinearModels for the other parameters.
+	*/
+	std::vector<RANSACFitReport> fitLinearModels(ColumnView abcissa, ColumnView ordinate, size_t maxNumberOfModels, const Core::CancellationToken& cancellationToken);
+
+	/**
+	* @brief Gets the number of iterations needed to draw an outlier-free sample with the given confidence.
+	* @param confidence The probability of drawing at least one outlier-free sample.
+	* @param inlierRatio The ratio of the inliers to all the data points.
+	* @param sampleSize The number of points in one sample.
+	* @param maxIterations The upper bound of the number of iterations.
+	* @return The number of iterations, between 1 and maxIterations.
+	*/
+	static size_t getRequiredNumberOfIterations(double confidence, double inlierRatio, size_t sampleSize, size_t maxIterations);
 
 private:
 	/**
-	* @brief Select indexes from a range of numbers randomly
-	* @param numberOfSelectedPoints The number of points to be selected
-	* @param noOfRows The total number of points
-	* @return A vector of randomly selected indexes
+	* @brief Get the settings of the engine for one fit, the deadline starts now.
+	*/
+	RansacEngineSettings makeEngineSettings(const Core::CancellationToken& cancellationToken) const;
+
+	/**
+	* @brief Run the engine selected by the parameters on the contiguous data points.
+	*/
+	RansacEngineResult fitValues(const double* abcissa, const double* ordinate, size_t noOfPoints, const RansacEngineSettings& settings) const;
+
+	/**
+	* @brief Get the report of the fit of the given number of data points.
+	*/
+	RANSACFitReport makeReport(RansacEngineResult&& result, const RansacEngineSettings& settings, size_t noOfPoints) const;
+
+	/**
+	* @brief The parameters of the RANSAC algorithm.
+	*/
+	RANSACParameters _parameters;
+
+	/**
+	* @brief The worker threads, empty for the serial evaluation.
 	*/
-	std::vector<size_t> getRandomIndexes(size_t numberOfSelectedPoints, size_t noOfRows);
+	std::shared_ptr<Core::ThreadPool> _pThreadPool;
 };
 
 } // namespace Fitting
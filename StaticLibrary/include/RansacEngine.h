@@ -0,0 +1,677 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "CancellationToken.h"
+#include "InlierCountingKernel.h"
+#include "InlierMask.h"
+#include "LinearModel.h"
+#include "PhiloxRandomGenerator.h"
+#include "RansacPolicies.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+/**
+* @brief Gets the number of iterations needed to draw an outlier-free sample with the given confidence.
+* @param confidence The probability of drawing at least one outlier-free sample.
+* @param inlierRatio The ratio of the inliers to all the data points.
+* @param sampleSize The number of points in one sample.
+* @param maxIterations The upper bound of the number of iterations.
+* @return The number of iterations, between 1 and maxIterations.
+*/
+inline size_t getRequiredNumberOfIterations(double confidence, double inlierRatio, size_t sampleSize, size_t maxIterations) {
+	// probability that a sample of sampleSize points contains inliers only
+	double outlierFreeSample = std::pow(std::min(std::max(inlierRatio, 0.0), 1.0), static_cast<double>(sampleSize));
+	if (outlierFreeSample >= 1.0) {
+		return std::min<size_t>(1, maxIterations);
+	}
+	double denominator = std::log1p(-outlierFreeSample);
+	if (denominator >= 0.0 || confidence >= 1.0) {
+		return maxIterations;
+	}
+	double iterations = std::ceil(std::log1p(-confidence) / denominator);
+	if (iterations >= static_cast<double>(maxIterations)) {
+		return maxIterations;
+	}
+	return std::max<size_t>(1, static_cast<size_t>(iterations));
+}
+
+/**
+* @struct RansacEngineSettings
+* @brief The run-time settings of a RansacEngine fit, the policies are chosen at compile time.
+*/
+struct RansacEngineSettings {
+	/**
+	* @brief The number of iterations, the upper bound of the adaptive iteration count.
+	*/
+	size_t maxIterations = 1;
+
+	/**
+	* @brief The threshold value to be considered as an inlier.
+	*/
+	double threshold = 1e9;
+
+	/**
+	* @brief The number of inliers a hypothesis needs to be refined and scored.
+	*/
+	size_t minimumInliers = 2;
+
+	/**
+	* @brief The probability of drawing at least one outlier-free sample, 0 keeps the number of iterations fixed.
+	*/
+	double targetConfidence = 0.0;
+
+	/**
+	* @brief The seed of the random samples.
+	*/
+	uint64_t seed = 0;
+
+	/**
+	* @brief The number of data points per round of the preemptive scoring, 0 disables it.
+	*/
+	size_t preemptiveBlockSize = 0;
+
+	/**
+	* @brief The fraction of the hypotheses kept after each round of the preemptive scoring.
+	*/
+	double preemptiveKeptFraction = 0.5;
+
+	/**
+	* @brief The inlier ratio of a bad hypothesis for the SPRT, 0 disables the SPRT.
+	*/
+	double sprtBadModelInlierRatio = 0.0;
+
+	/**
+	* @brief The number of hypotheses counted together tile by tile, 0 scores them one by one.
+	*/
+	size_t hypothesisBatchSize = 0;
+
+	/**
+	* @brief The time the fit has to stop at.
+	*/
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+	/**
+	* @brief The token polled between the iterations, none if null.
+	*/
+	const Core::CancellationToken* pCancellationToken = nullptr;
+
+	/**
+	* @brief The worker threads running the iterations, the fit is serial if null.
+	*/
+	Core::ThreadPool* pThreadPool = nullptr;
+};
+
+/**
+* @struct RansacEngineResult
+* @brief The outcome of a RansacEngine fit.
+*/
+struct RansacEngineResult {
+	LinearModel model;
+	InlierMask inlierMask;
+	size_t numberOfInliers = 0;
+	double sumOfSquaredResiduals = std::numeric_limits<double>::max();
+	size_t numberOfIterations = 0;
+	size_t mostInliers = 0;
+	size_t numberOfRejectedHypotheses = 0;
+	size_t numberOfLocalOptimizations = 0;
+	bool modelFound = false;
+	bool interrupted = false;
+};
+
+/**
+* @class RansacEngine
+* @brief The RANSAC loop specialized at compile time by its policies.
+*
+* The policies are called directly, so they are inlined in the hot loop:
+* - Model: the sample type (a std::array for a constexpr minimal sample size) and the solver of a hypothesis.
+* - Sampler: the selection of a sample from the random stream of the iteration.
+* - Scorer: the score of a refined hypothesis and the order of the scores, or of every hypothesis in its classification pass.
+* - Refiner: the improvement of a hypothesis with enough inliers before it is scored.
+*
+* The inliers are classified by the SIMD counting kernel, which the preemptive scoring, the SPRT
+* and the batched evaluation use as well. See RANSACFitStrategy for the description of the modes.
+*/
+template <typename Model, typename Sampler, typename Scorer, typename Refiner>
+class RansacEngine {
+  public:
+	using Score = typename Scorer::Score;
+	using Sample = typename Model::Sample;
+
+	/**
+	* @brief Constructor for the RansacEngine class.
+	* @param model The model policy.
+	* @param sampler The sampler policy.
+	* @param scorer The scorer policy.
+	* @param refiner The refiner policy.
+	*/
+	explicit RansacEngine(Model model = Model{}, Sampler sampler = Sampler{}, Scorer scorer = Scorer{}, Refiner refiner = Refiner{})
+		: _model{ std::move(model) }, _sampler{ std::move(sampler) }, _scorer{ std::move(scorer) }, _refiner{ std::move(refiner) }
+	{}
+
+	/**
+	* @brief Fit the model to the data points.
+	* @param abcissa The contiguous abcissa values of the data points.
+	* @param ordinate The contiguous ordinate values of the data points.
+	* @param noOfPoints The number of data points.
+	* @param settings The settings of the fit.
+	* @return The best refined hypothesis with its consensus set.
+	*/
+	RansacEngineResult fit(const double* abcissa, const double* ordinate, size_t noOfPoints, const RansacEngineSettings& settings) const {
+		Fit fit{ settings, abcissa, ordinate, noOfPoints };
+		fit.requiredIterations = settings.maxIterations;
+		// the blocks of the preemptive scoring and of the SPRT have to be random subsets, the rows are often ordered by the abcissa
+		if (settings.preemptiveBlockSize > 0 || settings.sprtBadModelInlierRatio > 0.0) {
+			fit.shuffle();
+		}
+
+		Candidate best;
+		if (settings.preemptiveBlockSize > 0) {
+			runPreemptiveScoring(fit, best);
+		}
+		else if (settings.pThreadPool != nullptr) {
+			std::vector<Candidate> bestOfThread(settings.pThreadPool->getNumberOfThreads());
+			settings.pThreadPool->runOnEachThread([&](size_t threadIndex) {
+				runIterations(fit, bestOfThread[threadIndex]);
+			});
+			for (Candidate& candidate : bestOfThread) {
+				if (candidate.isBetterThan(best)) {
+					best = std::move(candidate);
+				}
+			}
+		}
+		else {
+			runIterations(fit, best);
+		}
+
+		RansacEngineResult result;
+		result.modelFound = best.iteration != std::numeric_limits<size_t>::max();
+		result.model = best.model;
+		result.numberOfInliers = best.numberOfInliers;
+		if (result.modelFound) {
+			result.sumOfSquaredResiduals = sumOfSquaredResidualsOnInliers(best.model, abcissa, ordinate, best.inlierMask);
+			result.inlierMask = std::move(best.inlierMask);
+		}
+		else {
+			result.inlierMask.reset(noOfPoints);
+		}
+		result.numberOfIterations = fit.executedIterations;
+		result.mostInliers = fit.mostInliers;
+		result.numberOfRejectedHypotheses = fit.rejectedHypotheses;
+		result.numberOfLocalOptimizations = fit.localOptimizations;
+		result.interrupted = fit.interrupted;
+		return result;
+	}
+
+	/**
+	* @brief Get the number of data points in one sample.
+	*/
+	size_t getSampleSize() const {
+		return _model.makeSample().size();
+	}
+
+  private:
+	/**
+	* @brief The stream of the generator shuffling the data points, the iterations use the streams from 0.
+	*/
+	static constexpr uint64_t shuffleStream = std::numeric_limits<uint64_t>::max();
+
+	/**
+	* @brief The number of attempts to draw a non-degenerate sample before the iteration is given up.
+	*/
+	static constexpr size_t maxDegenerateSampleDraws = 100;
+
+	/**
+	* @brief The number of data points verified between two decisions of the SPRT, one word of the inlier mask.
+	*/
+	static constexpr size_t sprtBlockSize = inlierMaskWordBits;
+
+	/**
+	* @brief The cost of generating a hypothesis in the units of verifying one data point.
+	*/
+	static constexpr double sprtHypothesisCost = 200.0;
+
+	/**
+	* @brief The clock is read once per this number of iterations to check the deadline.
+	*/
+	static constexpr size_t deadlineCheckPeriod = 8;
+
+	/**
+	* @brief The data points and the progress of a fit shared by all the threads running its iterations.
+	*/
+	struct Fit {
+		const RansacEngineSettings& settings;
+		const double* abcissa;
+		const double* ordinate;
+		size_t noOfPoints;
+		std::vector<double> shuffledAbcissa;
+		std::vector<double> shuffledOrdinate;
+		std::atomic<size_t> nextIteration{ 0 };
+		std::atomic<size_t> requiredIterations{ 0 };
+		std::atomic<size_t> mostInliers{ 0 };
+		std::atomic<size_t> executedIterations{ 0 };
+		std::atomic<size_t> rejectedHypotheses{ 0 };
+		std::atomic<size_t> localOptimizations{ 0 };
+		std::atomic<bool> interrupted{ false };
+
+		Fit(const RansacEngineSettings& fitSettings, const double* abcissaValues, const double* ordinateValues, size_t size)
+			: settings{ fitSettings }, abcissa{ abcissaValues }, ordinate{ ordinateValues }, noOfPoints{ size } {}
+
+		/**
+		* @brief Fill the shuffled data points.
+		*/
+		void shuffle() {
+			std::vector<size_t> order(noOfPoints);
+			for (size_t index = 0; index < noOfPoints; index++) {
+				order[index] = index;
+			}
+			Core::PhiloxRandomGenerator orderGenerator{ settings.seed, shuffleStream };
+			for (size_t index = noOfPoints; index > 1; index--) {
+				std::swap(order[index - 1], order[static_cast<size_t>(orderGenerator.uniformIndex(index))]);
+			}
+			shuffledAbcissa.resize(noOfPoints);
+			shuffledOrdinate.resize(noOfPoints);
+			for (size_t index = 0; index < noOfPoints; index++) {
+				shuffledAbcissa[index] = abcissa[order[index]];
+				shuffledOrdinate[index] = ordinate[order[index]];
+			}
+		}
+
+		/**
+		* @brief Check if the fit has to stop because of the cancellation token or the deadline.
+		* @param checkClock True if the deadline is checked too, reading the clock is more expensive than the flags.
+		* @return True if the fit was interrupted.
+		*/
+		bool isInterrupted(bool checkClock) {
+			if (interrupted.load(std::memory_order_relaxed)) {
+				return true;
+			}
+			if ((settings.pCancellationToken != nullptr && settings.pCancellationToken->isCancelled())
+				|| (checkClock && std::chrono::steady_clock::now() >= settings.deadline)) {
+				interrupted = true;
+				return true;
+			}
+			return false;
+		}
+	};
+
+	/**
+	* @brief The best refined hypothesis found by a run of iterations.
+	*/
+	struct Candidate {
+		LinearModel model;
+		Score score = Scorer::getWorstScore();
+		size_t numberOfInliers = 0;
+		size_t iteration = std::numeric_limits<size_t>::max();
+		InlierMask inlierMask;
+
+		/**
+		* @brief Check if the candidate is better than the other one.
+		* @note Ties are resolved by the iteration index, so the merge does not depend on the thread timing.
+		*/
+		bool isBetterThan(const Candidate& other) const {
+			return isBetter(score, iteration, other);
+		}
+
+		/**
+		* @brief Check if the score of an iteration is better than the candidate.
+		*/
+		static bool isBetter(const Score& score, size_t iteration, const Candidate& other) {
+			if (Scorer::isBetter(score, other.score)) {
+				return true;
+			}
+			return !Scorer::isBetter(other.score, score) && iteration < other.iteration;
+		}
+	};
+
+	/**
+	* @brief Run the iterations handed out by the fit until the required number is reached.
+	*/
+	void runIterations(Fit& fit, Candidate& candidate) const {
+		if (fit.settings.hypothesisBatchSize > 0) {
+			runBatchedIterations(fit, candidate);
+			return;
+		}
+		Sample sample = _model.makeSample();
+		InlierMask hypothesisMask{ fit.noOfPoints };
+		// the iterations are handed out one by one, so a slow thread does not hold back the others
+		for (size_t iteration = fit.nextIteration++; iteration < fit.requiredIterations.load(); iteration = fit.nextIteration++) {
+			if (fit.isInterrupted(iteration % deadlineCheckPeriod == 0)) {
+				break;
+			}
+			size_t numberOfInliers = runIteration(fit, iteration, sample, candidate, hypothesisMask);
+			fit.executedIterations++;
+			updateProgress(fit, numberOfInliers);
+		}
+	}
+
+	/**
+	* @brief Run the iterations in batches, the inliers of a batch are counted in one sweep over the tiles of the data points.
+	*/
+	void runBatchedIterations(Fit& fit, Candidate& candidate) const {
+		size_t batchSize = fit.settings.hypothesisBatchSize;
+		Sample sample = _model.makeSample();
+		std::vector<LinearModel> hypotheses(batchSize);
+		std::vector<double> yIntercepts(batchSize);
+		std::vector<double> slopes(batchSize);
+		std::vector<size_t> iterations(batchSize);
+		std::vector<size_t> inlierCounts(batchSize);
+		InlierMask hypothesisMask{ fit.noOfPoints };
+		while (!fit.isInterrupted(true)) {
+			size_t firstIteration = fit.nextIteration.fetch_add(batchSize);
+			size_t lastIteration = std::min(firstIteration + batchSize, fit.requiredIterations.load());
+			if (firstIteration >= lastIteration) {
+				break;
+			}
+
+			size_t numberOfHypotheses = 0;
+			for (size_t iteration = firstIteration; iteration < lastIteration; iteration++) {
+				Core::PhiloxRandomGenerator generator{ fit.settings.seed, iteration };
+				if (generateHypothesis(fit, generator, sample, hypotheses[numberOfHypotheses])) {
+					yIntercepts[numberOfHypotheses] = hypotheses[numberOfHypotheses].getValueAt0();
+					slopes[numberOfHypotheses] = hypotheses[numberOfHypotheses].getSlope();
+					iterations[numberOfHypotheses] = iteration;
+					numberOfHypotheses++;
+				}
+			}
+			countInliersInTiles(
+				fit.abcissa, fit.ordinate, fit.noOfPoints,
+				yIntercepts.data(), slopes.data(), numberOfHypotheses, fit.settings.threshold, inlierCounts.data());
+
+			// the hypotheses below the minimal inlier count are settled by the batch count alone
+			for (size_t index = 0; index < numberOfHypotheses; index++) {
+				size_t numberOfInliers = inlierCounts[index];
+				bool mayImprove = Refiner::refinesNewBestOnly ? numberOfInliers > candidate.numberOfInliers : true;
+				if (numberOfInliers >= fit.settings.minimumInliers && mayImprove) {
+					numberOfInliers = evaluateHypothesis(fit, hypotheses[index], iterations[index], candidate, hypothesisMask);
+				}
+				updateProgress(fit, numberOfInliers);
+			}
+			fit.executedIterations += lastIteration - firstIteration;
+		}
+	}
+
+	/**
+	* @brief Record the number of inliers of a hypothesis and lower the required number of iterations if it is the most so far.
+	*/
+	void updateProgress(Fit& fit, size_t numberOfInliers) const {
+		size_t knownMostInliers = fit.mostInliers.load();
+		while (numberOfInliers > knownMostInliers && !fit.mostInliers.compare_exchange_weak(knownMostInliers, numberOfInliers)) {
+		}
+		if (numberOfInliers <= knownMostInliers || fit.settings.targetConfidence <= 0.0) {
+			return;
+		}
+		size_t required = getRequiredNumberOfIterations(
+			fit.settings.targetConfidence,
+			static_cast<double>(numberOfInliers) / static_cast<double>(fit.noOfPoints),
+			getSampleSize(),
+			fit.settings.maxIterations);
+		size_t knownRequired = fit.requiredIterations.load();
+		while (required < knownRequired && !fit.requiredIterations.compare_exchange_weak(knownRequired, required)) {
+		}
+	}
+
+	/**
+	* @brief Run one RANSAC iteration and keep its model if it is better than the candidate.
+	* @return The number of inliers of the hypothesis of the iteration, 0 if it was rejected by the SPRT.
+	*/
+	size_t runIteration(Fit& fit, size_t iteration, Sample& sample, Candidate& candidate, InlierMask& hypothesisMask) const {
+		// the iteration index selects the stream, the sample does not depend on the thread running the iteration
+		Core::PhiloxRandomGenerator generator{ fit.settings.seed, iteration };
+		LinearModel hypothesis;
+		if (!generateHypothesis(fit, generator, sample, hypothesis)) {
+			return 0;
+		}
+		if (fit.settings.sprtBadModelInlierRatio > 0.0 && !passesSprt(fit, hypothesis, fit.mostInliers.load())) {
+			fit.rejectedHypotheses++;
+			return 0;
+		}
+		return evaluateHypothesis(fit, hypothesis, iteration, candidate, hypothesisMask);
+	}
+
+	/**
+	* @brief Score the hypothesis on all the data points and keep its refined model if it is better than the candidate.
+	* @return The number of inliers of the hypothesis, after the refinement if it was run.
+	*/
+	size_t evaluateHypothesis(Fit& fit, const LinearModel& hypothesis, size_t iteration, Candidate& candidate, InlierMask& hypothesisMask) const {
+		if constexpr (Scorer::scoresInClassificationPass) {
+			return evaluateHypothesisInClassificationPass(fit, hypothesis, iteration, candidate, hypothesisMask);
+		} else {
+			double threshold = fit.settings.threshold;
+			size_t numberOfInliers = countInliers(
+				fit.abcissa, fit.ordinate, fit.noOfPoints,
+				hypothesis.getValueAt0(), hypothesis.getSlope(), threshold, hypothesisMask.getWords());
+			if (numberOfInliers < fit.settings.minimumInliers) {
+				return numberOfInliers;
+			}
+			if (Refiner::refinesNewBestOnly) {
+				// the refinement is paid for the new best hypotheses only
+				if (numberOfInliers <= candidate.numberOfInliers) {
+					return numberOfInliers;
+				}
+				fit.localOptimizations++;
+			}
+
+			LinearModel refinedModel = hypothesis;
+			numberOfInliers = _refiner.refine(fit.abcissa, fit.ordinate, fit.noOfPoints, threshold, refinedModel, hypothesisMask, numberOfInliers);
+			Score score = _scorer.score(fit.abcissa, fit.ordinate, fit.noOfPoints, threshold, refinedModel, hypothesisMask, numberOfInliers);
+			if (Candidate::isBetter(score, iteration, candidate)) {
+				candidate.model = refinedModel;
+				candidate.score = score;
+				candidate.numberOfInliers = numberOfInliers;
+				candidate.iteration = iteration;
+				candidate.inlierMask = hypothesisMask;
+			}
+			return numberOfInliers;
+		}
+	}
+
+	/**
+	* @brief Score the hypothesis while its inliers are counted, refine it only if it is better than the candidate.
+	* @return The number of inliers of the kept model of the hypothesis.
+	*/
+	size_t evaluateHypothesisInClassificationPass(Fit& fit, const LinearModel& hypothesis, size_t iteration, Candidate& candidate, InlierMask& hypothesisMask) const {
+		double threshold = fit.settings.threshold;
+		size_t numberOfInliers = 0;
+		Score score = _scorer.classify(fit.abcissa, fit.ordinate, fit.noOfPoints, threshold, hypothesis, hypothesisMask, numberOfInliers);
+		if (numberOfInliers < fit.settings.minimumInliers || !Candidate::isBetter(score, iteration, candidate)) {
+			return numberOfInliers;
+		}
+		if (Refiner::refinesNewBestOnly) {
+			fit.localOptimizations++;
+		}
+
+		// the refined model replaces the hypothesis only if it scores better on its own consensus set
+		LinearModel refinedModel = hypothesis;
+		InlierMask refinedMask = hypothesisMask;
+		_refiner.refine(fit.abcissa, fit.ordinate, fit.noOfPoints, threshold, refinedModel, refinedMask, numberOfInliers);
+		size_t numberOfRefinedInliers = 0;
+		Score refinedScore = _scorer.classify(fit.abcissa, fit.ordinate, fit.noOfPoints, threshold, refinedModel, refinedMask, numberOfRefinedInliers);
+		candidate.iteration = iteration;
+		if (numberOfRefinedInliers >= fit.settings.minimumInliers && Scorer::isBetter(refinedScore, score)) {
+			candidate.model = refinedModel;
+			candidate.score = refinedScore;
+			candidate.numberOfInliers = numberOfRefinedInliers;
+			candidate.inlierMask = std::move(refinedMask);
+			return numberOfRefinedInliers;
+		}
+		candidate.model = hypothesis;
+		candidate.score = score;
+		candidate.numberOfInliers = numberOfInliers;
+		candidate.inlierMask = hypothesisMask;
+		return numberOfInliers;
+	}
+
+	/**
+	* @brief Get the decision threshold of the SPRT minimizing the expected time of the fit.
+	* @param goodModelInlierRatio The probability of a data point being an inlier of a good model.
+	* @param badModelInlierRatio The probability of a data point being an inlier of a bad model.
+	* @see J. Matas, O. Chum, Randomized RANSAC with Sequential Probability Ratio Test, ICCV 2005.
+	*/
+	static double getSprtDecisionThreshold(double goodModelInlierRatio, double badModelInlierRatio) {
+		double informationPerPoint =
+			(1.0 - badModelInlierRatio) * std::log((1.0 - badModelInlierRatio) / (1.0 - goodModelInlierRatio))
+			+ badModelInlierRatio * std::log(badModelInlierRatio / goodModelInlierRatio);
+		double initialThreshold = sprtHypothesisCost * informationPerPoint + 1.0;
+		double threshold = initialThreshold;
+		// the fixed point of A = A0 + log(A) converges in a few steps
+		for (int step = 0; step < 10; step++) {
+			threshold = initialThreshold + std::log(threshold);
+		}
+		return threshold;
+	}
+
+	/**
+	* @brief Verify the hypothesis on the shuffled data points by the SPRT.
+	* @return False if the hypothesis was rejected, true if it has to be scored on all the data points.
+	*/
+	bool passesSprt(const Fit& fit, const LinearModel& hypothesis, size_t mostInliers) const {
+		size_t noOfPoints = fit.noOfPoints;
+		double goodModelInlierRatio = static_cast<double>(mostInliers) / static_cast<double>(noOfPoints);
+		double badModelInlierRatio = fit.settings.sprtBadModelInlierRatio;
+		// the test cannot tell the models apart until a hypothesis with more inliers than a bad model is known
+		if (goodModelInlierRatio <= badModelInlierRatio || goodModelInlierRatio >= 1.0) {
+			return true;
+		}
+		double inlierStep = std::log(badModelInlierRatio / goodModelInlierRatio);
+		double outlierStep = std::log((1.0 - badModelInlierRatio) / (1.0 - goodModelInlierRatio));
+		double logDecisionThreshold = std::log(getSprtDecisionThreshold(goodModelInlierRatio, badModelInlierRatio));
+
+		double logLikelihoodRatio = 0.0;
+		uint64_t blockMask = 0;
+		for (size_t blockStart = 0; blockStart < noOfPoints; blockStart += sprtBlockSize) {
+			size_t blockLength = std::min(sprtBlockSize, noOfPoints - blockStart);
+			size_t numberOfInliers = countInliers(
+				fit.shuffledAbcissa.data() + blockStart, fit.shuffledOrdinate.data() + blockStart, blockLength,
+				hypothesis.getValueAt0(), hypothesis.getSlope(), fit.settings.threshold, &blockMask);
+			logLikelihoodRatio += static_cast<double>(numberOfInliers) * inlierStep
+				+ static_cast<double>(blockLength - numberOfInliers) * outlierStep;
+			if (logLikelihoodRatio > logDecisionThreshold) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	* @brief Generate all the hypotheses up front and score them breadth-first on the blocks of the shuffled data points.
+	* @see D. Nister, Preemptive RANSAC for Live Structure and Motion Estimation, ICCV 2003.
+	*/
+	void runPreemptiveScoring(Fit& fit, Candidate& candidate) const {
+		struct ScoredHypothesis {
+			LinearModel model;
+			size_t iteration;
+			size_t score;
+		};
+
+		size_t numberOfHypotheses = fit.settings.maxIterations;
+		Sample sample = _model.makeSample();
+		std::vector<ScoredHypothesis> hypotheses;
+		hypotheses.reserve(numberOfHypotheses);
+		for (size_t iteration = 0; iteration < numberOfHypotheses; iteration++) {
+			if (fit.isInterrupted(iteration % deadlineCheckPeriod == 0)) {
+				break;
+			}
+			Core::PhiloxRandomGenerator generator{ fit.settings.seed, iteration };
+			LinearModel hypothesis;
+			if (generateHypothesis(fit, generator, sample, hypothesis)) {
+				hypotheses.push_back(ScoredHypothesis{ hypothesis, iteration, 0 });
+			}
+			fit.executedIterations++;
+		}
+		if (hypotheses.empty()) {
+			return;
+		}
+
+		size_t noOfPoints = fit.noOfPoints;
+		size_t blockSize = fit.settings.preemptiveBlockSize;
+		double keptFraction = std::min(std::max(fit.settings.preemptiveKeptFraction, 0.0), 1.0);
+		double threshold = fit.settings.threshold;
+		Core::ThreadPool* pThreadPool = fit.settings.pThreadPool;
+		size_t numberOfThreads = (pThreadPool != nullptr) ? pThreadPool->getNumberOfThreads() : 1;
+		std::vector<std::vector<uint64_t>> blockMaskOfThread(numberOfThreads, std::vector<uint64_t>(getInlierMaskWords(blockSize)));
+		auto scoreHypotheses = [&](size_t threadIndex, size_t blockStart, size_t blockLength) {
+			for (size_t index = threadIndex; index < hypotheses.size(); index += numberOfThreads) {
+				ScoredHypothesis& hypothesis = hypotheses[index];
+				hypothesis.score += countInliers(
+					fit.shuffledAbcissa.data() + blockStart, fit.shuffledOrdinate.data() + blockStart, blockLength,
+					hypothesis.model.getValueAt0(), hypothesis.model.getSlope(), threshold, blockMaskOfThread[threadIndex].data());
+			}
+		};
+		auto isRankedHigher = [](const ScoredHypothesis& first, const ScoredHypothesis& second) {
+			return (first.score > second.score) || (first.score == second.score && first.iteration < second.iteration);
+		};
+
+		// an interrupted scoring returns the leader of the rounds scored so far
+		for (size_t blockStart = 0; blockStart < noOfPoints && hypotheses.size() > 1 && !fit.isInterrupted(true); blockStart += blockSize) {
+			size_t blockLength = std::min(blockSize, noOfPoints - blockStart);
+			if (pThreadPool != nullptr && hypotheses.size() > numberOfThreads) {
+				pThreadPool->runOnEachThread([&](size_t threadIndex) { scoreHypotheses(threadIndex, blockStart, blockLength); });
+			}
+			else {
+				for (size_t threadIndex = 0; threadIndex < numberOfThreads; threadIndex++) {
+					scoreHypotheses(threadIndex, blockStart, blockLength);
+				}
+			}
+			size_t kept = std::max<size_t>(1, static_cast<size_t>(std::ceil(keptFraction * static_cast<double>(hypotheses.size()))));
+			if (kept < hypotheses.size()) {
+				std::nth_element(hypotheses.begin(), hypotheses.begin() + kept, hypotheses.end(), isRankedHigher);
+				hypotheses.resize(kept);
+			}
+		}
+
+		const ScoredHypothesis& survivor = *std::min_element(hypotheses.begin(), hypotheses.end(), isRankedHigher);
+		InlierMask hypothesisMask{ noOfPoints };
+		evaluateHypothesis(fit, survivor.model, survivor.iteration, candidate, hypothesisMask);
+	}
+
+	/**
+	* @brief Draw a sample of the data points and solve the hypothesis from it, degenerate samples are drawn again.
+	* @return False if no non-degenerate sample was drawn, true otherwise.
+	*/
+	bool generateHypothesis(const Fit& fit, Core::PhiloxRandomGenerator& generator, Sample& sample, LinearModel& hypothesis) const {
+		if (fit.noOfPoints < sample.size()) {
+			return false;
+		}
+		for (size_t draw = 0; draw < maxDegenerateSampleDraws; draw++) {
+			_sampler.draw(generator, fit.noOfPoints, sample);
+			if (_model.solve(fit.abcissa, fit.ordinate, sample, hypothesis)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	Model _model;
+	Sampler _sampler;
+	Scorer _scorer;
+	Refiner _refiner;
+};
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
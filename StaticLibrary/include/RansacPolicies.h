@@ -0,0 +1,352 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "InlierCountingKernel.h"
+#include "InlierMask.h"
+#include "LinearModel.h"
+#include "LinearSufficientStats.h"
+#include "MinimalLineSolver.h"
+#include "PhiloxRandomGenerator.h"
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+/**
+* @brief Fit the least squares line to the inliers of the mask, reading the data points in place.
+* @param abcissa The abcissa values of the data points.
+* @param ordinate The ordinate values of the data points.
+* @param inlierMask The inliers the line is fitted to.
+* @return The least squares line.
+*/
+inline LinearModel fitLeastSquaresOnInliers(const double* abcissa, const double* ordinate, const InlierMask& inlierMask) {
+	LinearSufficientStats stats;
+	inlierMask.forEachInlier([&](size_t index) {
+		stats.add(abcissa[index], ordinate[index]);
+	});
+	return stats.fit();
+}
+
+/**
+* @brief Get the sum of squared residuals of the model over the inliers of the mask.
+* @param model The linear model.
+* @param abcissa The abcissa values of the data points.
+* @param ordinate The ordinate values of the data points.
+* @param inlierMask The inliers the residuals are summed over.
+* @return The sum of squared residuals.
+*/
+inline double sumOfSquaredResidualsOnInliers(const LinearModel& model, const double* abcissa, const double* ordinate, const InlierMask& inlierMask) {
+	double yIntercept = model.getValueAt0();
+	double slope = model.getSlope();
+	double cummulativeSquare = 0;
+	inlierMask.forEachInlier([&](size_t index) {
+		double residual = (yIntercept + slope * abcissa[index]) - ordinate[index];
+		cummulativeSquare += residual * residual;
+	});
+	return cummulativeSquare;
+}
+
+// Model policies: the sample type and the solver of the hypothesis from a sample.
+
+/**
+* @struct TwoPointLineModel
+* @brief The line through a minimal sample of two data points.
+*/
+struct TwoPointLineModel {
+	static constexpr size_t sampleSize = MinimalLineSolver::sampleSize;
+	using Sample = std::array<size_t, sampleSize>;
+
+	Sample makeSample() const { return Sample{}; }
+
+	bool solve(const double* abcissa, const double* ordinate, const Sample& sample, LinearModel& model) const {
+		return MinimalLineSolver::solve(abcissa[sample[0]], ordinate[sample[0]], abcissa[sample[1]], ordinate[sample[1]], model);
+	}
+};
+
+/**
+* @class SampledLineModel
+* @brief The least squares line through a sample of a size chosen at run time.
+*/
+class SampledLineModel {
+  public:
+	using Sample = std::vector<size_t>;
+
+	/**
+	* @brief Constructor for the SampledLineModel class.
+	* @param sampleSize The number of data points in a sample, at least 2.
+	*/
+	explicit SampledLineModel(size_t sampleSize) : _sampleSize{ sampleSize } {}
+
+	Sample makeSample() const { return Sample(_sampleSize); }
+
+	bool solve(const double* abcissa, const double* ordinate, const Sample& sample, LinearModel& model) const {
+		double abcissaAverage = 0;
+		double ordinateAverage = 0;
+		size_t counter = 0;
+		for (size_t index : sample) {
+			++counter;
+			abcissaAverage += (abcissa[index] - abcissaAverage) / counter;
+			ordinateAverage += (ordinate[index] - ordinateAverage) / counter;
+		}
+		double numerator = 0;
+		double denominator = 0;
+		for (size_t index : sample) {
+			double abcissaCentralMoment = abcissa[index] - abcissaAverage;
+			numerator += abcissaCentralMoment * (ordinate[index] - ordinateAverage);
+			denominator += abcissaCentralMoment * abcissaCentralMoment;
+		}
+		double slope = numerator / denominator;
+		if (!std::isfinite(slope)) {
+			return false;
+		}
+		model.setSlope(slope);
+		model.setYIntercept(ordinateAverage - slope * abcissaAverage);
+		return true;
+	}
+
+  private:
+	size_t _sampleSize;
+};
+
+// Sampler policies: the selection of the sample from the random stream of the iteration.
+
+/**
+* @struct UniformSampler
+* @brief Distinct data points selected uniformly by Floyd's algorithm.
+*/
+struct UniformSampler {
+	template <typename Sample>
+	void draw(Core::PhiloxRandomGenerator& generator, size_t noOfPoints, Sample& sample) const {
+		Core::sampleIndexesWithoutReplacement(generator, noOfPoints, sample.size(), sample.data());
+	}
+};
+
+// Scorer policies: the score of a refined hypothesis, the engine keeps the best scored one.
+// A scorer scoring in the classification pass scores every hypothesis while its inliers are counted,
+// the engine refines only the hypotheses scoring better than the best one so far then.
+
+/**
+* @struct ResidualSumScorer
+* @brief The sum of squared residuals over the consensus set, the lower the better.
+*/
+struct ResidualSumScorer {
+	using Score = double;
+
+	static constexpr bool scoresInClassificationPass = false;
+
+	static Score getWorstScore() { return std::numeric_limits<double>::max(); }
+
+	static bool isBetter(const Score& score, const Score& other) { return score < other; }
+
+	Score score(const double* abcissa, const double* ordinate, size_t /*noOfPoints*/, double /*threshold*/,
+		const LinearModel& model, const InlierMask& inlierMask, size_t /*numberOfInliers*/) const
+	{
+		return sumOfSquaredResidualsOnInliers(model, abcissa, ordinate, inlierMask);
+	}
+};
+
+/**
+* @struct InlierCountScorer
+* @brief The number of inliers, the sum of squared residuals over them breaks the ties.
+*/
+struct InlierCountScorer {
+	struct Score {
+		size_t numberOfInliers;
+		double sumOfSquaredResiduals;
+	};
+
+	static constexpr bool scoresInClassificationPass = false;
+
+	static Score getWorstScore() { return Score{ 0, std::numeric_limits<double>::max() }; }
+
+	static bool isBetter(const Score& score, const Score& other) {
+		if (score.numberOfInliers != other.numberOfInliers) {
+			return score.numberOfInliers > other.numberOfInliers;
+		}
+		return score.sumOfSquaredResiduals < other.sumOfSquaredResiduals;
+	}
+
+	Score score(const double* abcissa, const double* ordinate, size_t /*noOfPoints*/, double /*threshold*/,
+		const LinearModel& model, const InlierMask& inlierMask, size_t numberOfInliers) const
+	{
+		return Score{ numberOfInliers, sumOfSquaredResidualsOnInliers(model, abcissa, ordinate, inlierMask) };
+	}
+};
+
+/**
+* @struct MsacScorer
+* @brief The MSAC truncated quadratic loss: the squared residual of an inlier, the squared threshold for an outlier, the lower the better.
+* @see P. H. S. Torr, A. Zisserman, MLESAC: A New Robust Estimator with Application to Estimating Image Geometry, CVIU 2000.
+*/
+struct MsacScorer {
+	using Score = double;
+
+	static constexpr bool scoresInClassificationPass = true;
+
+	static Score getWorstScore() { return std::numeric_limits<double>::max(); }
+
+	static bool isBetter(const Score& score, const Score& other) { return score < other; }
+
+	/**
+	* @brief Classify the data points by the model and score it in the same pass.
+	* @param inlierMask The mask receiving the inliers of the model.
+	* @param numberOfInliers The number of inliers of the model.
+	* @return The score of the model.
+	*/
+	Score classify(const double* abcissa, const double* ordinate, size_t noOfPoints, double threshold,
+		const LinearModel& model, InlierMask& inlierMask, size_t& numberOfInliers) const
+	{
+		double inlierSquaredResiduals = 0.0;
+		numberOfInliers = scoreInliers(
+			abcissa, ordinate, noOfPoints, model.getValueAt0(), model.getSlope(), threshold, inlierMask.getWords(), inlierSquaredResiduals);
+		return inlierSquaredResiduals + static_cast<double>(noOfPoints - numberOfInliers) * threshold * threshold;
+	}
+};
+
+/**
+* @class MlesacScorer
+* @brief The MLESAC negative log-likelihood of a mixture of the gaussian inliers and the uniform outliers, the lower the better.
+*
+* The data points are assigned to the inliers and the outliers by the threshold, the mixing parameter is the inlier ratio
+* and the standard deviation of the inliers is the threshold / 1.96, so the likelihood is known after the classification pass.
+* @see P. H. S. Torr, A. Zisserman, MLESAC: A New Robust Estimator with Application to Estimating Image Geometry, CVIU 2000.
+*/
+class MlesacScorer {
+  public:
+	using Score = double;
+
+	static constexpr bool scoresInClassificationPass = true;
+
+	/**
+	* @brief Constructor for the MlesacScorer class.
+	* @param outlierRange The range of the ordinate values the outliers are uniformly distributed over.
+	*/
+	explicit MlesacScorer(double outlierRange) : _outlierRange{ outlierRange } {}
+
+	static Score getWorstScore() { return std::numeric_limits<double>::max(); }
+
+	static bool isBetter(const Score& score, const Score& other) { return score < other; }
+
+	/**
+	* @brief Classify the data points by the model and score it in the same pass.
+	* @param inlierMask The mask receiving the inliers of the model.
+	* @param numberOfInliers The number of inliers of the model.
+	* @return The score of the model.
+	*/
+	Score classify(const double* abcissa, const double* ordinate, size_t noOfPoints, double threshold,
+		const LinearModel& model, InlierMask& inlierMask, size_t& numberOfInliers) const
+	{
+		double inlierSquaredResiduals = 0.0;
+		numberOfInliers = scoreInliers(
+			abcissa, ordinate, noOfPoints, model.getValueAt0(), model.getSlope(), threshold, inlierMask.getWords(), inlierSquaredResiduals);
+		if (noOfPoints == 0) {
+			return 0.0;
+		}
+		double inliers = static_cast<double>(numberOfInliers);
+		double outliers = static_cast<double>(noOfPoints - numberOfInliers);
+		double inlierRatio = inliers / static_cast<double>(noOfPoints);
+		double sigma = threshold / inlierSigmaRange;
+		double logLikelihood = 0.0;
+		if (numberOfInliers > 0) {
+			logLikelihood += inliers * (std::log(inlierRatio) - std::log(sqrtOfTwoPi * sigma))
+				- inlierSquaredResiduals / (2.0 * sigma * sigma);
+		}
+		if (numberOfInliers < noOfPoints) {
+			logLikelihood += outliers * (std::log(1.0 - inlierRatio) - std::log(_outlierRange));
+		}
+		return -logLikelihood;
+	}
+
+  private:
+	/**
+	* @brief The threshold in the standard deviations of the inliers, 95 % of the gaussian inliers are within it.
+	*/
+	static constexpr double inlierSigmaRange = 1.96;
+
+	static constexpr double sqrtOfTwoPi = 2.5066282746310002;
+
+	double _outlierRange;
+};
+
+// Refiner policies: the improvement of a hypothesis with enough inliers before it is scored.
+
+/**
+* @struct LeastSquaresRefiner
+* @brief The least squares fit to the consensus set of every hypothesis with enough inliers.
+*/
+struct LeastSquaresRefiner {
+	/**
+	* @brief True if only the hypotheses with more inliers than the best one so far are refined.
+	*/
+	static constexpr bool refinesNewBestOnly = false;
+
+	size_t refine(const double* abcissa, const double* ordinate, size_t /*noOfPoints*/, double /*threshold*/,
+		LinearModel& model, InlierMask& inlierMask, size_t numberOfInliers) const
+	{
+		model = fitLeastSquaresOnInliers(abcissa, ordinate, inlierMask);
+		return numberOfInliers;
+	}
+};
+
+/**
+* @class LocalOptimizationRefiner
+* @brief The LO-RANSAC refinement: refit to the inliers and classify the data points again until the consensus stops growing.
+* @see O. Chum, J. Matas, J. Kittler, Locally Optimized RANSAC, DAGM 2003.
+*/
+class LocalOptimizationRefiner {
+  public:
+	static constexpr bool refinesNewBestOnly = true;
+
+	/**
+	* @brief Constructor for the LocalOptimizationRefiner class.
+	* @param steps The maximal number of refit and re-threshold steps.
+	*/
+	explicit LocalOptimizationRefiner(int steps) : _steps{ steps } {}
+
+	size_t refine(const double* abcissa, const double* ordinate, size_t noOfPoints, double threshold,
+		LinearModel& model, InlierMask& inlierMask, size_t numberOfInliers) const
+	{
+		InlierMask refitMask{ noOfPoints };
+		for (int step = 0; step < _steps; step++) {
+			LinearModel refitModel = fitLeastSquaresOnInliers(abcissa, ordinate, inlierMask);
+			size_t numberOfRefitInliers = countInliers(
+				abcissa, ordinate, noOfPoints, refitModel.getValueAt0(), refitModel.getSlope(), threshold, refitMask.getWords());
+			if (numberOfRefitInliers < numberOfInliers) {
+				break;
+			}
+			std::swap(inlierMask, refitMask);
+			bool converged = numberOfRefitInliers == numberOfInliers;
+			numberOfInliers = numberOfRefitInliers;
+			if (converged) {
+				break;
+			}
+		}
+		model = fitLeastSquaresOnInliers(abcissa, ordinate, inlierMask);
+		return numberOfInliers;
+	}
+
+  private:
+	int _steps;
+};
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
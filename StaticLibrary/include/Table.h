@@ -16,6 +16,7 @@
 #include "Column.h"
 #include "ITable.h"
 #include <iostream>
+#include <memory_resource>
 #include <string>
 
 namespace ConsoleAppRansacIINamespace {
@@ -27,13 +28,16 @@ namespace Core {
 * A table is a collection of columns.
 * Each column is a collection of cells.
 * Each cell is a value.
+* The columns are allocated from the polymorphic memory resource of the table, e.g. a monotonic arena,
+* so a whole table can be released at once with its arena. A copy of a table uses the default resource.
 * 
 * Features:
-* - Add a column to the table.
+* - Add a column to the table, copied or moved into the memory resource of the table.
 * - Get the number of columns in the table.
 * - Get the name of the table.
 * - Get the common number of rows in all columns.
 * - Get a column from the table.
+* - Get a read-only view of a column without copying it.
 * - Get a cell value from the table.
 * - Output the table to an output stream.
 * - Exception handling for out of bounds column indexes.
@@ -45,13 +49,14 @@ class Table : public ITable {
 	/**
 	* @brief Constructor for the Table class.
 	* @param name The name of the table.
-	* @param noOfColumns The number of columns in the table.
+	* @param pMemoryResource The memory resource to allocate the columns from.
 	*/
-	Table(std::string name="") : _name(name), _noOfColumns(0) {};
+	Table(std::string name="", std::pmr::memory_resource* pMemoryResource = std::pmr::get_default_resource())
+		: _tableColumns(pMemoryResource), _name(name), _noOfColumns(0) {};
 
 	/**
 	* @brief Copy constructor
-	* @param other The other table to be copied.
+	* @param other The other table to be copied, the copy is allocated from the default memory resource.
 	*/
 	Table(const Table& other) = default;
 
@@ -102,6 +107,18 @@ class Table : public ITable {
 	*/
 	virtual void appendColumn(const Column & column) override;
 
+	/**
+	* @brief Add a column to the table, without copying it if it is allocated from the memory resource of the table.
+	* @param column The column to be added to the table.
+	*/
+	void appendColumn(Column&& column);
+
+	/**
+	* @brief Get the memory resource the columns are allocated from.
+	* @return The memory resource of the table.
+	*/
+	std::pmr::memory_resource* getMemoryResource() const { return _tableColumns.get_allocator().resource(); }
+
 	/**
 	* @brief Get the column of the specified index from the table.
 	* @param index The index of the column to get.
@@ -109,13 +126,36 @@ class Table : public ITable {
 	*/
 	virtual Column getColumn(size_t index) const override;
 
+	/**
+	* @brief Get the read-only view of the column of the specified index, without copying the column.
+	* @param index The index of the column to view.
+	* @return The view of the column, valid until the table is modified or destroyed.
+	*/
+	virtual ColumnView getColumnView(size_t index) const override;
+
 	/**
 	* @brief Get the value of the cell at the specified row and column indexes.
 	* @param cellRowIndex The row index of the cell.
 	* @param cellColumnIndex The column index of the cell.
 	* @return The value of the cell at the specified row and column indexes.
+	* @note Each index is checked by one branch, the exception messages are built only when thrown.
+	*/
+	virtual double getCellValue(size_t cellRowIndex, size_t cellColumnIndex) const override {
+		if (cellColumnIndex >= _noOfColumns) {
+			throw ColumnIndexOutOfBounds(cellColumnIndex, _noOfColumns);
+		}
+		return _tableColumns[cellColumnIndex].getOneRow(cellRowIndex);
+	}
+
+	/**
+	* @brief Get the value of the cell at the specified row and column indexes without checking the indexes.
+	* @param cellRowIndex The row index of the cell, less than the number of rows of the column.
+	* @param cellColumnIndex The column index of the cell, less than getNoOfColumns().
+	* @return The value of the cell at the specified row and column indexes.
 	*/
-	virtual double getCellValue(size_t cellRowIndex, size_t cellColumnIndex) const override;
+	double getCellValueUnchecked(size_t cellRowIndex, size_t cellColumnIndex) const noexcept {
+		return _tableColumns[cellColumnIndex].getOneRowUnchecked(cellRowIndex);
+	}
 	
 	/**
 	* @brief Output the table to an output stream.
@@ -157,7 +197,7 @@ class Table : public ITable {
 	/**
 	* @brief The vector of columns in the table.
 	*/
-	std::vector<Column> _tableColumns;
+	std::pmr::vector<Column> _tableColumns;
 
 	/**
 	* @brief The name of the table.
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "Table.h"
+#include <memory_resource>
 #include <vector>
 #include <string>
 
@@ -42,6 +43,10 @@ class ITableBuilder {
 /**
 * @class CsvTableBuilder
 * @brief A class that builds a table from a CSV file.
+*
+* The lines, the tokens and the columns of the table are allocated from the memory resource
+* of the builder, so with a monotonic arena the table and its parse scratch are released at once
+* with the arena, which has to outlive the table.
 */
 class CsvTableBuilder : public ITableBuilder {
   public:
@@ -49,8 +54,10 @@ class CsvTableBuilder : public ITableBuilder {
 	* @brief Constructor for the CsvTableBuilder class.
 	* @param csvFilename The name of the CSV file.
 	* @param hdLines The number of header lines in the CSV file.
+	* @param pMemoryResource The memory resource to allocate the table and the parse scratch from.
 	*/
-	  CsvTableBuilder(std::string csvFilename = "", int hdLines = 0);
+	  CsvTableBuilder(std::string csvFilename = "", int hdLines = 0,
+		  std::pmr::memory_resource* pMemoryResource = std::pmr::get_default_resource());
 		 // : _csvFilename{ csvFilename }, _hdLines{ hdLines };
 
 	/**
@@ -79,6 +86,11 @@ class CsvTableBuilder : public ITableBuilder {
 	* @brief The number of header lines in the CSV file.
  	*/
 	int _hdLines;
+
+	/**
+	* @brief The memory resource of the table and the parse scratch.
+	*/
+	std::pmr::memory_resource* _pMemoryResource;
 };
 
 } // namespace IO
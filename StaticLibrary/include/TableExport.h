@@ -13,8 +13,10 @@
 
 #pragma once
 
+#include "ColumnSelection.h"
 #include "Table.h"
 #include <string>
+#include <vector>
 
 using Table = ConsoleAppRansacIINamespace::Core::Table;
 
@@ -172,6 +174,16 @@ class TableExport {
     */
     std::string ExportToCsvString(const Table& table, const char delimiter = ',') const;
 
+    /**
+	* @brief Exports the selected rows of columns to a CSV string, the values are read through the selections without copying the columns.
+	* @param tableName The name written on the first line.
+	* @param columns The column selections, all of the same number of rows, e.g. the inliers of a fit.
+	* @param delimiter The delimiter character.
+	* @return The CSV string, laid out as the one of a table.
+	* @throw Core::Column::RowIndexOutOfBounds If the selections have different numbers of rows.
+    */
+    std::string ExportToCsvString(const std::string& tableName, const std::vector<Core::ColumnSelection>& columns, const char delimiter = ',') const;
+
     /**
 	* @brief Exports a table to a CSV file.
 	* @param table The table to export.
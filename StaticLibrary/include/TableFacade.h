@@ -109,6 +109,15 @@ public:
 		return _pTable->getColumn(columnIndex);
 	}
 
+	/**
+	* @brief Get the read-only view of a column from the table, without copying the column.
+	* @param columnIndex The index of the column in the table.
+	* @return The view of the column, valid until the table is modified or destroyed.
+	*/
+	Core::ColumnView getColumnView(size_t columnIndex) const {
+		return _pTable->getColumnView(columnIndex);
+	}
+
 	/**
 	* @brief Get the value at a specified cell in the table.
 	* @param cellRowIndex The row index of the cell.
@@ -0,0 +1,67 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "ILinearModelFitStrategy.h"
+#include "ThreadPool.h"
+
+#include <memory>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+/**
+* @class TheilSenFitStrategy
+* @brief The Theil-Sen fitting algorithm/strategy: the slope is the median of the slopes of all the pairs of data points,
+* the y-intercept is the median of y - slope * x.
+*
+* The median slope is selected without materializing the n * (n - 1) / 2 slopes. In the dual plane a data point is
+* the line v = y - t * x and the slope of a pair is the t where their lines cross, so the number of the slopes in an
+* interval is the number of the inversions between the orders of the lines at its ends, counted by a merge sort.
+* A random sample of the slopes in the interval brackets the median, the interval shrinks to the bracket
+* and the few slopes left are enumerated, so the selection takes O(n log n) time and O(n) memory in expectation.
+*
+* The pairs of data points with equal abcissa values have no slope and are skipped. The random sample affects
+* the running time only, the result is the median slope for any number of threads.
+*
+* @see J. Matousek, Randomized Optimal Algorithm for Slope Selection, Information Processing Letters 39, 1991.
+* @see M. B. Dillencourt, D. M. Mount, N. S. Netanyahu, A Randomized Algorithm for Slope Selection, IJCGA 2, 1992.
+*/
+class TheilSenFitStrategy : public ILinearModelFitStrategy {
+public:
+	/**
+	* @brief Constructor.
+	* @param numberOfThreads The number of threads sorting and counting the inversions, 1 means serial, 0 means one per hardware thread.
+	*/
+	explicit TheilSenFitStrategy(int numberOfThreads = 1);
+
+	/**
+	* @brief Fits a linear model to a set of data points using the Theil-Sen estimator.
+	* @param abcissa The abcissa values of the data points.
+	* @param ordinate The ordinate values of the data points.
+	* @return The linear model that fits the (abcissa,ordinate), its slope is NaN if all the abcissa values are equal.
+	* @throw DifferentNoOfRows If the abcissa and the ordinate have different numbers of rows.
+	*/
+	virtual LinearModel fitLinearModel(ColumnView abcissa, ColumnView ordinate) override;
+
+private:
+	/**
+	* @brief The worker threads, empty for the serial selection.
+	*/
+	std::shared_ptr<Core::ThreadPool> _pThreadPool;
+};
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
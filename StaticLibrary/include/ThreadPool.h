@@ -0,0 +1,122 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Core {
+
+/**
+* @class ThreadPool
+* @brief A fixed size pool of worker threads executing submitted tasks.
+*
+* The workers are started by the constructor and joined by the destructor,
+* so the cost of creating the threads is paid once per pool and not once per task.
+*
+* Features:
+* - Submit a task and wait for it through a future.
+* - Run one task per worker thread and wait for all of them.
+* - Exceptions thrown by a task are rethrown to the waiting caller.
+*/
+class ThreadPool {
+  public:
+	/**
+	* @brief Constructor for the ThreadPool class.
+	* @param numberOfThreads The number of worker threads, 0 means one per hardware thread.
+	*/
+	explicit ThreadPool(size_t numberOfThreads);
+
+	/**
+	* @brief Copy constructor (deleted, the worker threads cannot be shared)
+	*/
+	ThreadPool(const ThreadPool& other) = delete;
+
+	/**
+	* @brief Copy assignment operator (deleted, the worker threads cannot be shared)
+	*/
+	ThreadPool& operator=(const ThreadPool& other) = delete;
+
+	/**
+	* @brief Destructor, finishes the queued tasks and joins the worker threads.
+	*/
+	~ThreadPool();
+
+	/**
+	* @brief Get the number of worker threads.
+	* @return The number of worker threads.
+	*/
+	size_t getNumberOfThreads() const { return _workers.size(); }
+
+	/**
+	* @brief Queue a task to be executed by one of the worker threads.
+	* @param task The task to be executed.
+	* @return The future which becomes ready when the task has finished.
+	*/
+	std::future<void> submit(std::function<void()> task);
+
+	/**
+	* @brief Run the task once per worker thread and wait until all of them have finished.
+	* @param task The task, it receives the index of the run (0 .. number of threads - 1).
+	* @note The first exception thrown by any of the runs is rethrown after all runs have finished.
+	*/
+	void runOnEachThread(const std::function<void(size_t)>& task);
+
+	/**
+	* @brief Get the number of threads that corresponds to the requested one.
+	* @param requestedNumberOfThreads The requested number of threads, 0 means one per hardware thread.
+	* @return The number of threads, at least 1.
+	*/
+	static size_t resolveNumberOfThreads(size_t requestedNumberOfThreads);
+
+  private:
+	/**
+	* @brief The loop executed by each worker thread.
+	*/
+	void workerLoop();
+
+	/**
+	* @brief The worker threads.
+	*/
+	std::vector<std::thread> _workers;
+
+	/**
+	* @brief The queue of the tasks waiting for a worker.
+	*/
+	std::queue<std::packaged_task<void()>> _tasks;
+
+	/**
+	* @brief The mutex guarding the task queue and the stop flag.
+	*/
+	std::mutex _mutex;
+
+	/**
+	* @brief The condition signalled when a task is queued or the pool stops.
+	*/
+	std::condition_variable _taskAvailable;
+
+	/**
+	* @brief The flag telling the workers to finish.
+	*/
+	bool _stopping;
+};
+
+} // namespace Core
+} // namespace ConsoleAppRansacIINamespace
@@ -20,8 +20,9 @@
 namespace ConsoleAppRansacIINamespace {
 namespace Core {
 
-Column::Column(const std::vector<double>& rowVector, const std::string header)
-	: _colHeader(header), _noRows(rowVector.size())
+template <typename T>
+BasicColumn<T>::BasicColumn(const std::vector<T>& rowVector, const std::string header, std::pmr::memory_resource* pMemoryResource)
+	: _colValues(pMemoryResource), _noRows(rowVector.size()), _colHeader(header, pMemoryResource)
 	 {
 	    try {
 	      _colValues.reserve(rowVector.size());
@@ -32,10 +33,23 @@ Column::Column(const std::vector<double>& rowVector, const std::string header)
 			exceptionMessage.append(getIndexAndColumnNameMessage(_noRows));
 			throw BadAlloc(exceptionMessage);
 		}
-		_colValues = rowVector;
+		_colValues.assign(rowVector.begin(), rowVector.end());
 };
 
-void Column::addRow(const double value) {
+template <typename T>
+BasicColumn<T>::BasicColumn(std::pmr::vector<T>&& rowVector, std::string_view header)
+	: _colValues(std::move(rowVector)), _noRows(_colValues.size()), _colHeader(header, _colValues.get_allocator())
+{
+}
+
+template <typename T>
+BasicColumn<T>::BasicColumn(const BasicColumn& other, std::pmr::memory_resource* pMemoryResource)
+	: _colValues(other._colValues, pMemoryResource), _noRows(other._noRows), _colHeader(other._colHeader, pMemoryResource)
+{
+}
+
+template <typename T>
+void BasicColumn<T>::addRow(const T value) {
 	try {
 		_colValues.emplace_back(value);
 		_noRows++;
@@ -47,7 +61,8 @@ void Column::addRow(const double value) {
 	}
 }
 
-std::string Column::getIndexAndColumnNameMessage(const size_t& index) const {
+template <typename T>
+std::string BasicColumn<T>::getIndexAndColumnNameMessage(const size_t& index) const {
 	std::string message{};
 	message.append("Index: ").append(std::to_string(index));
 	message.append(" Column name: ").append(getHeader());
@@ -55,65 +70,76 @@ std::string Column::getIndexAndColumnNameMessage(const size_t& index) const {
 }
 
 
-std::vector<double> Column::getValuesAtSelectedIndexes(const std::vector<size_t>& selectedIndexes) const {
-	std::vector<double> result{};
-	for (size_t index = 0; index < selectedIndexes.size(); index++) {
-		if (index + 1 > _noRows) {
-			std::string exceptionMessage{ "The index is out of bounds |" };
-			exceptionMessage.append(getIndexAndColumnNameMessage(index));
-			throw RowIndexOutOfBounds(exceptionMessage);
-		}
-		else
-		{
-			result.push_back(_colValues.at(selectedIndexes.at(index)));
-		}
+template <typename T>
+std::vector<T> BasicColumn<T>::getValuesAtSelectedIndexes(const std::vector<size_t>& selectedIndexes) const {
+	std::vector<T> result{};
+	result.reserve(selectedIndexes.size());
+	for (size_t selectedIndex : selectedIndexes) {
+		result.push_back(getOneRow(selectedIndex));
 	}
 	return result;
 }
 
-size_t Column::getNoOfRows() const { 
-	return _noRows; 
+template <typename T>
+void BasicColumn<T>::throwRowIndexOutOfBounds(size_t index) const {
+	std::string exceptionMessage{ "The index is out of bounds |" };
+	exceptionMessage.append(getIndexAndColumnNameMessage(index));
+	throw RowIndexOutOfBounds(exceptionMessage);
 }
 
-std::string Column::getHeader() const { 
-	return _colHeader; 
+template <typename T>
+size_t BasicColumn<T>::getNoOfRows() const { 
+	return _noRows; 
 }
 
-std::vector<double> Column::getAllRows() const { 
-	return _colValues;	
+template <typename T>
+std::string BasicColumn<T>::getHeader() const { 
+	return std::string{ _colHeader }; 
 }
 
-
-double Column::getOneRow(const size_t& specifiedRowIndex) const {
-	std::vector<size_t> selectedIndexes{ specifiedRowIndex };
-	return getValuesAtSelectedIndexes(selectedIndexes)[0];
-};
+template <typename T>
+std::vector<T> BasicColumn<T>::getAllRows() const { 
+	return std::vector<T>(_colValues.begin(), _colValues.end());	
+}
 
 
-Column Column::getSpecifiedRows(const std::vector<size_t>& specifiedRowIndexes) const {
-	std::vector<double> resultValues{ getValuesAtSelectedIndexes(specifiedRowIndexes) };
+template <typename T>
+BasicColumn<T> BasicColumn<T>::getSpecifiedRows(const std::vector<size_t>& specifiedRowIndexes) const {
+	std::vector<T> resultValues{ getValuesAtSelectedIndexes(specifiedRowIndexes) };
 	std::string selectedPostfix{"- selected"};
 	std::string resultHeader = getHeader().append(selectedPostfix);
 
-	return Column{ resultValues, resultHeader };
+	return BasicColumn{ resultValues, resultHeader };
 }
 
-std::ostream& operator<<(std::ostream& os, const Column& column) {
-	for (double item : column._colValues) {
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const BasicColumn<T>& column) {
+	for (T item : column._colValues) {
 		os << (item) << std::endl;
 	};
 	return os;
 }
 
-double Column::getAverage() const {
+template <typename T>
+double BasicColumn<T>::getAverage() const {
 	double mean = 0;
 	size_t counter = 0;
 	for (auto item : _colValues) {
 		++counter;
-		mean += (item - mean) / counter;
+		mean += (static_cast<double>(item) - mean) / counter;
 	}
 	return mean;
 }
 
+template class BasicColumn<double>;
+template class BasicColumn<float>;
+template class BasicColumn<int32_t>;
+template class BasicColumn<int64_t>;
+
+template std::ostream& operator<<(std::ostream& os, const BasicColumn<double>& column);
+template std::ostream& operator<<(std::ostream& os, const BasicColumn<float>& column);
+template std::ostream& operator<<(std::ostream& os, const BasicColumn<int32_t>& column);
+template std::ostream& operator<<(std::ostream& os, const BasicColumn<int64_t>& column);
+
 } // namespace Core
 } // namespace ConsoleAppRansacIINamespace
\ No newline at end of file
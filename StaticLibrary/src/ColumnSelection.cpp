@@ -0,0 +1,99 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ColumnSelection.h"
+#include "CpuFeatures.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(RANSAC_III_X86_64_KERNELS)
+#include <immintrin.h>
+#endif
+
+namespace ConsoleAppRansacIINamespace {
+namespace Core {
+
+namespace {
+
+/**
+* @brief Hint the cache to load the value, the rows of a gather are random reads the hardware prefetcher cannot predict.
+*/
+inline void prefetchRow(const double* value) {
+#if defined(RANSAC_III_X86_64_KERNELS)
+	_mm_prefetch(reinterpret_cast<const char*>(value), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(value);
+#else
+	(void)value;
+#endif
+}
+
+} // namespace
+
+void gatherRows(const double* values, const size_t* rowIndexes, size_t noOfSelectedRows, double* selectedValues) {
+	size_t selectedRow = 0;
+	if (noOfSelectedRows > gatherPrefetchDistance) {
+		for (; selectedRow < noOfSelectedRows - gatherPrefetchDistance; selectedRow++) {
+			prefetchRow(values + rowIndexes[selectedRow + gatherPrefetchDistance]);
+			selectedValues[selectedRow] = values[rowIndexes[selectedRow]];
+		}
+	}
+	for (; selectedRow < noOfSelectedRows; selectedRow++) {
+		selectedValues[selectedRow] = values[rowIndexes[selectedRow]];
+	}
+}
+
+RowSelection::RowSelection(const uint64_t* maskWords, size_t noOfRows) {
+	constexpr size_t wordBits = 64;
+	size_t noOfWords = (noOfRows + wordBits - 1) / wordBits;
+	for (size_t wordIndex = 0; wordIndex < noOfWords; wordIndex++) {
+		uint64_t word = maskWords[wordIndex];
+		for (size_t bit = 0; word != 0; bit++, word >>= 1) {
+			if ((word & 1) != 0 && wordIndex * wordBits + bit < noOfRows) {
+				_rowIndexes.push_back(wordIndex * wordBits + bit);
+			}
+		}
+	}
+}
+
+size_t RowSelection::getRequiredNoOfRows() const {
+	return _rowIndexes.empty() ? 0 : *std::max_element(_rowIndexes.begin(), _rowIndexes.end()) + 1;
+}
+
+ColumnSelection::ColumnSelection(ColumnView base, std::shared_ptr<const RowSelection> pRows)
+	: _base{ base }, _pRows{ std::move(pRows) }
+{
+	if (!_pRows) {
+		throw std::invalid_argument("The selected rows are null | Column name: " + std::string{ _base.getHeader() });
+	}
+	size_t requiredNoOfRows = _pRows->getRequiredNoOfRows();
+	if (requiredNoOfRows > _base.getNoOfRows()) {
+		std::string message{ "The selected row is out of bounds |Index: " };
+		message.append(std::to_string(requiredNoOfRows - 1)).append(" Column name: ").append(_base.getHeader());
+		throw Column::RowIndexOutOfBounds(message);
+	}
+}
+
+std::vector<double> ColumnSelection::materialize() const {
+	std::vector<double> values(getNoOfRows());
+	materialize(0, values.size(), values.data());
+	return values;
+}
+
+Column ColumnSelection::materializeColumn(const std::string& header) const {
+	return Column{ materialize(), header };
+}
+
+} // namespace Core
+} // namespace ConsoleAppRansacIINamespace
@@ -0,0 +1,100 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CpuFeatures.h"
+
+#if defined(RANSAC_III_X86_64_KERNELS) && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace ConsoleAppRansacIINamespace {
+namespace Core {
+
+#if defined(RANSAC_III_X86_64_KERNELS) && defined(_MSC_VER) && !defined(__clang__)
+namespace {
+
+// CPUID leaf 1 ECX: OSXSAVE (27), AVX (28); leaf 7 EBX: AVX2 (5), AVX512F (16)
+// XCR0: SSE and AVX state (bits 1, 2), AVX-512 opmask and ZMM state (bits 5, 6, 7)
+bool cpuSupports(InstructionSet instructionSet) {
+	int registers[4];
+	__cpuid(registers, 1);
+	bool osUsesXsave = (registers[2] & (1 << 27)) != 0;
+	bool hasAvx = (registers[2] & (1 << 28)) != 0;
+	if (!osUsesXsave || !hasAvx) {
+		return false;
+	}
+	unsigned long long enabledStates = _xgetbv(0);
+	__cpuidex(registers, 7, 0);
+	if (instructionSet == InstructionSet::AVX2) {
+		return ((enabledStates & 0x6) == 0x6) && (registers[1] & (1 << 5)) != 0;
+	}
+	return ((enabledStates & 0xE6) == 0xE6) && (registers[1] & (1 << 16)) != 0;
+}
+
+} // namespace
+#endif
+
+bool isInstructionSetSupported(InstructionSet instructionSet) {
+	switch (instructionSet) {
+	case InstructionSet::Scalar:
+		return true;
+#if defined(RANSAC_III_X86_64_KERNELS)
+	case InstructionSet::SSE2:
+		// SSE2 is a part of the x86-64 baseline
+		return true;
+#if defined(_MSC_VER) && !defined(__clang__)
+	case InstructionSet::AVX2:
+	case InstructionSet::AVX512:
+		return cpuSupports(instructionSet);
+#else
+	case InstructionSet::AVX2:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2");
+	case InstructionSet::AVX512:
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx512f");
+#endif
+#endif
+	default:
+		return false;
+	}
+}
+
+InstructionSet getBestSupportedInstructionSet() {
+	static const InstructionSet bestSupported = []() {
+		for (InstructionSet candidate : { InstructionSet::AVX512, InstructionSet::AVX2, InstructionSet::SSE2 }) {
+			if (isInstructionSetSupported(candidate)) {
+				return candidate;
+			}
+		}
+		return InstructionSet::Scalar;
+	}();
+	return bestSupported;
+}
+
+std::string getInstructionSetName(InstructionSet instructionSet) {
+	switch (instructionSet) {
+	case InstructionSet::SSE2:
+		return "SSE2";
+	case InstructionSet::AVX2:
+		return "AVX2";
+	case InstructionSet::AVX512:
+		return "AVX-512";
+	default:
+		return "Scalar";
+	}
+}
+
+} // namespace Core
+} // namespace ConsoleAppRansacIINamespace
@@ -0,0 +1,525 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "InlierCountingKernel.h"
+
+#include <bitset>
+#include <cmath>
+
+#if defined(RANSAC_III_X86_64_KERNELS)
+#include <immintrin.h>
+#endif
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+namespace {
+
+using CountInliersKernel = size_t(*)(const double*, const double*, size_t, double, double, double, uint64_t*);
+using ScoreInliersKernel = size_t(*)(const double*, const double*, size_t, double, double, double, uint64_t*, double&);
+using GatherSquaredResidualsKernel = size_t(*)(const double*, const double*, size_t, double, double, double, double*);
+
+size_t countBits(uint64_t word) {
+	return std::bitset<inlierMaskWordBits>(word).count();
+}
+
+/**
+* @brief Mark the inliers among the points [firstPoint, noOfPoints) of a partially filled last word.
+*/
+uint64_t markInliersScalar(
+	const double* abcissa, const double* ordinate, size_t firstPoint, size_t noOfPoints,
+	double yIntercept, double slope, double threshold)
+{
+	uint64_t word = 0;
+	for (size_t index = firstPoint; index < noOfPoints; index++) {
+		double residual = (yIntercept + slope * abcissa[index]) - ordinate[index];
+		if (std::fabs(residual) < threshold) {
+			word |= uint64_t{ 1 } << (index - firstPoint);
+		}
+	}
+	return word;
+}
+
+size_t countInliersScalar(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask)
+{
+	size_t numberOfInliers = 0;
+	for (size_t firstPoint = 0, wordIndex = 0; firstPoint < noOfPoints; firstPoint += inlierMaskWordBits, wordIndex++) {
+		size_t lastPoint = (noOfPoints - firstPoint < inlierMaskWordBits) ? noOfPoints : firstPoint + inlierMaskWordBits;
+		uint64_t word = markInliersScalar(abcissa, ordinate, firstPoint, lastPoint, yIntercept, slope, threshold);
+		inlierMask[wordIndex] = word;
+		numberOfInliers += countBits(word);
+	}
+	return numberOfInliers;
+}
+
+/**
+* @brief Mark the inliers among the points [firstPoint, noOfPoints) and add their squared residuals to the sum.
+*/
+uint64_t markAndScoreInliersScalar(
+	const double* abcissa, const double* ordinate, size_t firstPoint, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, double& inlierSquaredResiduals)
+{
+	uint64_t word = 0;
+	for (size_t index = firstPoint; index < noOfPoints; index++) {
+		double residual = (yIntercept + slope * abcissa[index]) - ordinate[index];
+		if (std::fabs(residual) < threshold) {
+			word |= uint64_t{ 1 } << (index - firstPoint);
+			inlierSquaredResiduals += residual * residual;
+		}
+	}
+	return word;
+}
+
+size_t scoreInliersScalar(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask, double& inlierSquaredResiduals)
+{
+	size_t numberOfInliers = 0;
+	inlierSquaredResiduals = 0.0;
+	for (size_t firstPoint = 0, wordIndex = 0; firstPoint < noOfPoints; firstPoint += inlierMaskWordBits, wordIndex++) {
+		size_t lastPoint = (noOfPoints - firstPoint < inlierMaskWordBits) ? noOfPoints : firstPoint + inlierMaskWordBits;
+		uint64_t word = markAndScoreInliersScalar(abcissa, ordinate, firstPoint, lastPoint, yIntercept, slope, threshold, inlierSquaredResiduals);
+		inlierMask[wordIndex] = word;
+		numberOfInliers += countBits(word);
+	}
+	return numberOfInliers;
+}
+
+/**
+* @brief Store every squared residual at the end of the packed ones and keep it by advancing the end if it is within the bound.
+*/
+size_t gatherSquaredResidualsScalar(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double bound, double* squaredResiduals)
+{
+	size_t numberOfGathered = 0;
+	for (size_t index = 0; index < noOfPoints; index++) {
+		double residual = (yIntercept + slope * abcissa[index]) - ordinate[index];
+		double squaredResidual = residual * residual;
+		squaredResiduals[numberOfGathered] = squaredResidual;
+		numberOfGathered += (squaredResidual <= bound) ? 1 : 0;
+	}
+	return numberOfGathered;
+}
+
+#if defined(RANSAC_III_X86_64_KERNELS)
+
+size_t countInliersSSE2(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask)
+{
+	const __m128d intercepts = _mm_set1_pd(yIntercept);
+	const __m128d slopes = _mm_set1_pd(slope);
+	const __m128d thresholds = _mm_set1_pd(threshold);
+	const __m128d absoluteValueMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+	size_t numberOfInliers = 0;
+	size_t fullWords = noOfPoints / inlierMaskWordBits;
+	for (size_t wordIndex = 0; wordIndex < fullWords; wordIndex++) {
+		const double* x = abcissa + wordIndex * inlierMaskWordBits;
+		const double* y = ordinate + wordIndex * inlierMaskWordBits;
+		uint64_t word = 0;
+		for (size_t lane = 0; lane < inlierMaskWordBits; lane += 2) {
+			__m128d residuals = _mm_sub_pd(_mm_add_pd(intercepts, _mm_mul_pd(slopes, _mm_loadu_pd(x + lane))), _mm_loadu_pd(y + lane));
+			__m128d isInlier = _mm_cmplt_pd(_mm_and_pd(residuals, absoluteValueMask), thresholds);
+			word |= static_cast<uint64_t>(_mm_movemask_pd(isInlier)) << lane;
+		}
+		inlierMask[wordIndex] = word;
+		numberOfInliers += countBits(word);
+	}
+	if (fullWords * inlierMaskWordBits < noOfPoints) {
+		uint64_t word = markInliersScalar(abcissa, ordinate, fullWords * inlierMaskWordBits, noOfPoints, yIntercept, slope, threshold);
+		inlierMask[fullWords] = word;
+		numberOfInliers += countBits(word);
+	}
+	return numberOfInliers;
+}
+
+RANSAC_III_TARGET_AVX2
+size_t countInliersAVX2(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask)
+{
+	const __m256d intercepts = _mm256_set1_pd(yIntercept);
+	const __m256d slopes = _mm256_set1_pd(slope);
+	const __m256d thresholds = _mm256_set1_pd(threshold);
+	const __m256d absoluteValueMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+	size_t numberOfInliers = 0;
+	size_t fullWords = noOfPoints / inlierMaskWordBits;
+	for (size_t wordIndex = 0; wordIndex < fullWords; wordIndex++) {
+		const double* x = abcissa + wordIndex * inlierMaskWordBits;
+		const double* y = ordinate + wordIndex * inlierMaskWordBits;
+		uint64_t word = 0;
+		for (size_t lane = 0; lane < inlierMaskWordBits; lane += 4) {
+			// no fused multiply-add, so every kernel rounds the residual as the scalar one does
+			__m256d residuals = _mm256_sub_pd(_mm256_add_pd(intercepts, _mm256_mul_pd(slopes, _mm256_loadu_pd(x + lane))), _mm256_loadu_pd(y + lane));
+			__m256d isInlier = _mm256_cmp_pd(_mm256_and_pd(residuals, absoluteValueMask), thresholds, _CMP_LT_OQ);
+			word |= static_cast<uint64_t>(_mm256_movemask_pd(isInlier)) << lane;
+		}
+		inlierMask[wordIndex] = word;
+		numberOfInliers += countBits(word);
+	}
+	if (fullWords * inlierMaskWordBits < noOfPoints) {
+		uint64_t word = markInliersScalar(abcissa, ordinate, fullWords * inlierMaskWordBits, noOfPoints, yIntercept, slope, threshold);
+		inlierMask[fullWords] = word;
+		numberOfInliers += countBits(word);
+	}
+	return numberOfInliers;
+}
+
+RANSAC_III_TARGET_AVX512
+size_t countInliersAVX512(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask)
+{
+	const __m512d intercepts = _mm512_set1_pd(yIntercept);
+	const __m512d slopes = _mm512_set1_pd(slope);
+	const __m512d thresholds = _mm512_set1_pd(threshold);
+	size_t numberOfInliers = 0;
+	size_t fullWords = noOfPoints / inlierMaskWordBits;
+	for (size_t wordIndex = 0; wordIndex < fullWords; wordIndex++) {
+		const double* x = abcissa + wordIndex * inlierMaskWordBits;
+		const double* y = ordinate + wordIndex * inlierMaskWordBits;
+		uint64_t word = 0;
+		for (size_t lane = 0; lane < inlierMaskWordBits; lane += 8) {
+			__m512d residuals = _mm512_sub_pd(_mm512_add_pd(intercepts, _mm512_mul_pd(slopes, _mm512_loadu_pd(x + lane))), _mm512_loadu_pd(y + lane));
+			__mmask8 isInlier = _mm512_cmp_pd_mask(_mm512_abs_pd(residuals), thresholds, _CMP_LT_OQ);
+			word |= static_cast<uint64_t>(isInlier) << lane;
+		}
+		inlierMask[wordIndex] = word;
+		numberOfInliers += countBits(word);
+	}
+	if (fullWords * inlierMaskWordBits < noOfPoints) {
+		uint64_t word = markInliersScalar(abcissa, ordinate, fullWords * inlierMaskWordBits, noOfPoints, yIntercept, slope, threshold);
+		inlierMask[fullWords] = word;
+		numberOfInliers += countBits(word);
+	}
+	return numberOfInliers;
+}
+
+size_t scoreInliersSSE2(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask, double& inlierSquaredResiduals)
+{
+	const __m128d intercepts = _mm_set1_pd(yIntercept);
+	const __m128d slopes = _mm_set1_pd(slope);
+	const __m128d thresholds = _mm_set1_pd(threshold);
+	const __m128d absoluteValueMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+	__m128d squaredResiduals = _mm_setzero_pd();
+	size_t numberOfInliers = 0;
+	size_t fullWords = noOfPoints / inlierMaskWordBits;
+	for (size_t wordIndex = 0; wordIndex < fullWords; wordIndex++) {
+		const double* x = abcissa + wordIndex * inlierMaskWordBits;
+		const double* y = ordinate + wordIndex * inlierMaskWordBits;
+		uint64_t word = 0;
+		for (size_t lane = 0; lane < inlierMaskWordBits; lane += 2) {
+			__m128d residuals = _mm_sub_pd(_mm_add_pd(intercepts, _mm_mul_pd(slopes, _mm_loadu_pd(x + lane))), _mm_loadu_pd(y + lane));
+			__m128d isInlier = _mm_cmplt_pd(_mm_and_pd(residuals, absoluteValueMask), thresholds);
+			squaredResiduals = _mm_add_pd(squaredResiduals, _mm_and_pd(_mm_mul_pd(residuals, residuals), isInlier));
+			word |= static_cast<uint64_t>(_mm_movemask_pd(isInlier)) << lane;
+		}
+		inlierMask[wordIndex] = word;
+		numberOfInliers += countBits(word);
+	}
+	double lanes[2];
+	_mm_storeu_pd(lanes, squaredResiduals);
+	inlierSquaredResiduals = lanes[0] + lanes[1];
+	if (fullWords * inlierMaskWordBits < noOfPoints) {
+		uint64_t word = markAndScoreInliersScalar(abcissa, ordinate, fullWords * inlierMaskWordBits, noOfPoints, yIntercept, slope, threshold, inlierSquaredResiduals);
+		inlierMask[fullWords] = word;
+		numberOfInliers += countBits(word);
+	}
+	return numberOfInliers;
+}
+
+RANSAC_III_TARGET_AVX2
+size_t scoreInliersAVX2(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask, double& inlierSquaredResiduals)
+{
+	const __m256d intercepts = _mm256_set1_pd(yIntercept);
+	const __m256d slopes = _mm256_set1_pd(slope);
+	const __m256d thresholds = _mm256_set1_pd(threshold);
+	const __m256d absoluteValueMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+	__m256d squaredResiduals = _mm256_setzero_pd();
+	size_t numberOfInliers = 0;
+	size_t fullWords = noOfPoints / inlierMaskWordBits;
+	for (size_t wordIndex = 0; wordIndex < fullWords; wordIndex++) {
+		const double* x = abcissa + wordIndex * inlierMaskWordBits;
+		const double* y = ordinate + wordIndex * inlierMaskWordBits;
+		uint64_t word = 0;
+		for (size_t lane = 0; lane < inlierMaskWordBits; lane += 4) {
+			__m256d residuals = _mm256_sub_pd(_mm256_add_pd(intercepts, _mm256_mul_pd(slopes, _mm256_loadu_pd(x + lane))), _mm256_loadu_pd(y + lane));
+			__m256d isInlier = _mm256_cmp_pd(_mm256_and_pd(residuals, absoluteValueMask), thresholds, _CMP_LT_OQ);
+			squaredResiduals = _mm256_add_pd(squaredResiduals, _mm256_and_pd(_mm256_mul_pd(residuals, residuals), isInlier));
+			word |= static_cast<uint64_t>(_mm256_movemask_pd(isInlier)) << lane;
+		}
+		inlierMask[wordIndex] = word;
+		numberOfInliers += countBits(word);
+	}
+	double lanes[4];
+	_mm256_storeu_pd(lanes, squaredResiduals);
+	inlierSquaredResiduals = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+	if (fullWords * inlierMaskWordBits < noOfPoints) {
+		uint64_t word = markAndScoreInliersScalar(abcissa, ordinate, fullWords * inlierMaskWordBits, noOfPoints, yIntercept, slope, threshold, inlierSquaredResiduals);
+		inlierMask[fullWords] = word;
+		numberOfInliers += countBits(word);
+	}
+	return numberOfInliers;
+}
+
+RANSAC_III_TARGET_AVX512
+size_t scoreInliersAVX512(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask, double& inlierSquaredResiduals)
+{
+	const __m512d intercepts = _mm512_set1_pd(yIntercept);
+	const __m512d slopes = _mm512_set1_pd(slope);
+	const __m512d thresholds = _mm512_set1_pd(threshold);
+	__m512d squaredResiduals = _mm512_setzero_pd();
+	size_t numberOfInliers = 0;
+	size_t fullWords = noOfPoints / inlierMaskWordBits;
+	for (size_t wordIndex = 0; wordIndex < fullWords; wordIndex++) {
+		const double* x = abcissa + wordIndex * inlierMaskWordBits;
+		const double* y = ordinate + wordIndex * inlierMaskWordBits;
+		uint64_t word = 0;
+		for (size_t lane = 0; lane < inlierMaskWordBits; lane += 8) {
+			__m512d residuals = _mm512_sub_pd(_mm512_add_pd(intercepts, _mm512_mul_pd(slopes, _mm512_loadu_pd(x + lane))), _mm512_loadu_pd(y + lane));
+			__mmask8 isInlier = _mm512_cmp_pd_mask(_mm512_abs_pd(residuals), thresholds, _CMP_LT_OQ);
+			squaredResiduals = _mm512_mask_add_pd(squaredResiduals, isInlier, squaredResiduals, _mm512_mul_pd(residuals, residuals));
+			word |= static_cast<uint64_t>(isInlier) << lane;
+		}
+		inlierMask[wordIndex] = word;
+		numberOfInliers += countBits(word);
+	}
+	// the lanes are added in the order of _mm512_reduce_add_pd, which GCC 12 reports as reading an uninitialized register
+	double lanes[8];
+	_mm512_storeu_pd(lanes, squaredResiduals);
+	inlierSquaredResiduals = ((lanes[0] + lanes[4]) + (lanes[2] + lanes[6])) + ((lanes[1] + lanes[5]) + (lanes[3] + lanes[7]));
+	if (fullWords * inlierMaskWordBits < noOfPoints) {
+		uint64_t word = markAndScoreInliersScalar(abcissa, ordinate, fullWords * inlierMaskWordBits, noOfPoints, yIntercept, slope, threshold, inlierSquaredResiduals);
+		inlierMask[fullWords] = word;
+		numberOfInliers += countBits(word);
+	}
+	return numberOfInliers;
+}
+
+/**
+* @struct LanePacking
+* @brief The permutations moving the kept lanes of four doubles to the front, indexed by the 4-bit mask of the kept lanes.
+*/
+struct LanePacking {
+	alignas(32) int32_t permutations[16][8];
+	size_t numberOfKept[16];
+};
+
+constexpr LanePacking makeLanePacking() {
+	LanePacking packing{};
+	for (int mask = 0; mask < 16; mask++) {
+		int kept = 0;
+		for (int lane = 0; lane < 4; lane++) {
+			if ((mask >> lane) & 1) {
+				// a double lane is a pair of the 32-bit elements permuted by _mm256_permutevar8x32_epi32
+				packing.permutations[mask][2 * kept] = 2 * lane;
+				packing.permutations[mask][2 * kept + 1] = 2 * lane + 1;
+				kept++;
+			}
+		}
+		packing.numberOfKept[mask] = static_cast<size_t>(kept);
+	}
+	return packing;
+}
+
+constexpr LanePacking lanePacking = makeLanePacking();
+
+RANSAC_III_TARGET_AVX2
+size_t gatherSquaredResidualsAVX2(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double bound, double* squaredResiduals)
+{
+	const __m256d intercepts = _mm256_set1_pd(yIntercept);
+	const __m256d slopes = _mm256_set1_pd(slope);
+	const __m256d bounds = _mm256_set1_pd(bound);
+	size_t numberOfGathered = 0;
+	size_t index = 0;
+	// the four lanes are stored whole, the packed end never passes the current point, so the store stays in the array
+	for (; index + 4 <= noOfPoints; index += 4) {
+		__m256d residuals = _mm256_sub_pd(_mm256_add_pd(intercepts, _mm256_mul_pd(slopes, _mm256_loadu_pd(abcissa + index))), _mm256_loadu_pd(ordinate + index));
+		__m256d squares = _mm256_mul_pd(residuals, residuals);
+		int isKept = _mm256_movemask_pd(_mm256_cmp_pd(squares, bounds, _CMP_LE_OQ));
+		__m256i permutation = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanePacking.permutations[isKept]));
+		__m256d packed = _mm256_castsi256_pd(_mm256_permutevar8x32_epi32(_mm256_castpd_si256(squares), permutation));
+		_mm256_storeu_pd(squaredResiduals + numberOfGathered, packed);
+		numberOfGathered += lanePacking.numberOfKept[isKept];
+	}
+	return numberOfGathered + gatherSquaredResidualsScalar(
+		abcissa + index, ordinate + index, noOfPoints - index, yIntercept, slope, bound, squaredResiduals + numberOfGathered);
+}
+
+RANSAC_III_TARGET_AVX512
+size_t gatherSquaredResidualsAVX512(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double bound, double* squaredResiduals)
+{
+	const __m512d intercepts = _mm512_set1_pd(yIntercept);
+	const __m512d slopes = _mm512_set1_pd(slope);
+	const __m512d bounds = _mm512_set1_pd(bound);
+	size_t numberOfGathered = 0;
+	size_t index = 0;
+	// compressed in the register and stored whole, a compressing store to the memory is slow on some cores
+	for (; index + 8 <= noOfPoints; index += 8) {
+		__m512d residuals = _mm512_sub_pd(_mm512_add_pd(intercepts, _mm512_mul_pd(slopes, _mm512_loadu_pd(abcissa + index))), _mm512_loadu_pd(ordinate + index));
+		__m512d squares = _mm512_mul_pd(residuals, residuals);
+		__mmask8 isKept = _mm512_cmp_pd_mask(squares, bounds, _CMP_LE_OQ);
+		_mm512_storeu_pd(squaredResiduals + numberOfGathered, _mm512_maskz_compress_pd(isKept, squares));
+		numberOfGathered += countBits(isKept);
+	}
+	return numberOfGathered + gatherSquaredResidualsScalar(
+		abcissa + index, ordinate + index, noOfPoints - index, yIntercept, slope, bound, squaredResiduals + numberOfGathered);
+}
+
+#endif
+
+CountInliersKernel getKernel(Core::InstructionSet instructionSet) {
+	switch (instructionSet) {
+#if defined(RANSAC_III_X86_64_KERNELS)
+	case Core::InstructionSet::AVX512:
+		return &countInliersAVX512;
+	case Core::InstructionSet::AVX2:
+		return &countInliersAVX2;
+	case Core::InstructionSet::SSE2:
+		return &countInliersSSE2;
+#endif
+	default:
+		return &countInliersScalar;
+	}
+}
+
+void countInliersInTiles(
+	CountInliersKernel kernel,
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	const double* yIntercepts, const double* slopes, size_t numberOfLines,
+	double threshold, size_t* inlierCounts)
+{
+	uint64_t tileMask[getInlierMaskWords(inlierCountingTileSize)];
+	for (size_t line = 0; line < numberOfLines; line++) {
+		inlierCounts[line] = 0;
+	}
+	for (size_t tileStart = 0; tileStart < noOfPoints; tileStart += inlierCountingTileSize) {
+		size_t tileLength = (noOfPoints - tileStart < inlierCountingTileSize) ? noOfPoints - tileStart : inlierCountingTileSize;
+		for (size_t line = 0; line < numberOfLines; line++) {
+			inlierCounts[line] += kernel(abcissa + tileStart, ordinate + tileStart, tileLength, yIntercepts[line], slopes[line], threshold, tileMask);
+		}
+	}
+}
+
+ScoreInliersKernel getScoringKernel(Core::InstructionSet instructionSet) {
+	switch (instructionSet) {
+#if defined(RANSAC_III_X86_64_KERNELS)
+	case Core::InstructionSet::AVX512:
+		return &scoreInliersAVX512;
+	case Core::InstructionSet::AVX2:
+		return &scoreInliersAVX2;
+	case Core::InstructionSet::SSE2:
+		return &scoreInliersSSE2;
+#endif
+	default:
+		return &scoreInliersScalar;
+	}
+}
+
+GatherSquaredResidualsKernel getGatheringKernel(Core::InstructionSet instructionSet) {
+	switch (instructionSet) {
+#if defined(RANSAC_III_X86_64_KERNELS)
+	case Core::InstructionSet::AVX512:
+		return &gatherSquaredResidualsAVX512;
+	case Core::InstructionSet::AVX2:
+		return &gatherSquaredResidualsAVX2;
+#endif
+	// two lanes leave too little to pack, SSE2 runs the branchless scalar loop
+	default:
+		return &gatherSquaredResidualsScalar;
+	}
+}
+
+} // namespace
+
+size_t countInliers(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask)
+{
+	static const CountInliersKernel selectedKernel = getKernel(Core::getBestSupportedInstructionSet());
+	return selectedKernel(abcissa, ordinate, noOfPoints, yIntercept, slope, threshold, inlierMask);
+}
+
+size_t countInliers(
+	Core::InstructionSet instructionSet,
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask)
+{
+	return getKernel(instructionSet)(abcissa, ordinate, noOfPoints, yIntercept, slope, threshold, inlierMask);
+}
+
+void countInliersInTiles(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	const double* yIntercepts, const double* slopes, size_t numberOfLines,
+	double threshold, size_t* inlierCounts)
+{
+	static const CountInliersKernel selectedKernel = getKernel(Core::getBestSupportedInstructionSet());
+	countInliersInTiles(selectedKernel, abcissa, ordinate, noOfPoints, yIntercepts, slopes, numberOfLines, threshold, inlierCounts);
+}
+
+void countInliersInTiles(
+	Core::InstructionSet instructionSet,
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	const double* yIntercepts, const double* slopes, size_t numberOfLines,
+	double threshold, size_t* inlierCounts)
+{
+	countInliersInTiles(getKernel(instructionSet), abcissa, ordinate, noOfPoints, yIntercepts, slopes, numberOfLines, threshold, inlierCounts);
+}
+
+size_t scoreInliers(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask, double& inlierSquaredResiduals)
+{
+	static const ScoreInliersKernel selectedKernel = getScoringKernel(Core::getBestSupportedInstructionSet());
+	return selectedKernel(abcissa, ordinate, noOfPoints, yIntercept, slope, threshold, inlierMask, inlierSquaredResiduals);
+}
+
+size_t scoreInliers(
+	Core::InstructionSet instructionSet,
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double threshold, uint64_t* inlierMask, double& inlierSquaredResiduals)
+{
+	return getScoringKernel(instructionSet)(abcissa, ordinate, noOfPoints, yIntercept, slope, threshold, inlierMask, inlierSquaredResiduals);
+}
+
+size_t gatherSquaredResiduals(
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double bound, double* squaredResiduals)
+{
+	static const GatherSquaredResidualsKernel selectedKernel = getGatheringKernel(Core::getBestSupportedInstructionSet());
+	return selectedKernel(abcissa, ordinate, noOfPoints, yIntercept, slope, bound, squaredResiduals);
+}
+
+size_t gatherSquaredResiduals(
+	Core::InstructionSet instructionSet,
+	const double* abcissa, const double* ordinate, size_t noOfPoints,
+	double yIntercept, double slope, double bound, double* squaredResiduals)
+{
+	return getGatheringKernel(instructionSet)(abcissa, ordinate, noOfPoints, yIntercept, slope, bound, squaredResiduals);
+}
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
\ No newline at end of file
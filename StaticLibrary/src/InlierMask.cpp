@@ -0,0 +1,47 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "InlierMask.h"
+
+#include <bitset>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+InlierMask::InlierMask(size_t noOfPoints)
+	: _words(getInlierMaskWords(noOfPoints), 0), _noOfPoints{ noOfPoints }
+{
+}
+
+void InlierMask::reset(size_t noOfPoints) {
+	_words.assign(getInlierMaskWords(noOfPoints), 0);
+	_noOfPoints = noOfPoints;
+}
+
+size_t InlierMask::getNumberOfInliers() const {
+	size_t numberOfInliers = 0;
+	for (uint64_t word : _words) {
+		numberOfInliers += std::bitset<inlierMaskWordBits>(word).count();
+	}
+	return numberOfInliers;
+}
+
+std::vector<size_t> InlierMask::getInlierIndexes() const {
+	std::vector<size_t> inlierIndexes;
+	inlierIndexes.reserve(getNumberOfInliers());
+	forEachInlier([&inlierIndexes](size_t index) { inlierIndexes.push_back(index); });
+	return inlierIndexes;
+}
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
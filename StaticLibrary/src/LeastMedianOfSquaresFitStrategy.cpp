@@ -0,0 +1,210 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "LeastMedianOfSquaresFitStrategy.h"
+#include "InlierCountingKernel.h"
+#include "PhiloxRandomGenerator.h"
+#include "RansacPolicies.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+namespace {
+
+/**
+* @brief The number of iterations a worker takes at once from the shared counter.
+*/
+constexpr size_t iterationsPerBatch = 16;
+
+/**
+* @brief The number of attempts to draw a non-degenerate sample before the iteration is given up.
+*/
+constexpr size_t maxDegenerateSampleDraws = 100;
+
+/**
+* @brief The ratio of the standard deviation to the median absolute value of a normal distribution, 1 / Phi^-1(0.75).
+*/
+constexpr double normalConsistencyFactor = 1.4826;
+
+/**
+* @brief The data points within this many robust scales of the best hypothesis are refitted.
+*/
+constexpr double refinementCutoff = 2.5;
+
+/**
+* @struct ScoredHypothesis
+* @brief A hypothesis with its median squared residual, the lower median wins and the earlier iteration breaks the ties.
+*/
+struct ScoredHypothesis {
+	LinearModel model;
+	double medianOfSquaredResiduals = std::numeric_limits<double>::infinity();
+	size_t iteration = std::numeric_limits<size_t>::max();
+
+	bool isBetterThan(const ScoredHypothesis& other) const {
+		if (medianOfSquaredResiduals != other.medianOfSquaredResiduals) {
+			return medianOfSquaredResiduals < other.medianOfSquaredResiduals;
+		}
+		return iteration < other.iteration;
+	}
+};
+
+/**
+* @struct WorkerResult
+* @brief The best hypothesis scored by one worker.
+*/
+struct WorkerResult {
+	ScoredHypothesis best;
+	size_t numberOfMedianSelections = 0;
+};
+
+/**
+* @brief Lower the shared bound to the value if the value is lower.
+*/
+void lowerBound(std::atomic<double>& bound, double value) {
+	double current = bound.load();
+	while (value < current && !bound.compare_exchange_weak(current, value)) {
+	}
+}
+
+/**
+* @brief Draw the sample of the iteration and solve the line through it, degenerate samples are drawn again.
+*/
+bool drawHypothesis(const double* abcissa, const double* ordinate, size_t noOfPoints, uint64_t seed, size_t iteration, LinearModel& hypothesis) {
+	TwoPointLineModel model;
+	TwoPointLineModel::Sample sample = model.makeSample();
+	Core::PhiloxRandomGenerator generator{ seed, iteration };
+	for (size_t draw = 0; draw < maxDegenerateSampleDraws; draw++) {
+		UniformSampler{}.draw(generator, noOfPoints, sample);
+		if (model.solve(abcissa, ordinate, sample, hypothesis)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+* @brief Score the iterations taken from the shared counter until there are none left.
+* @param bestMedian The best median found by any worker so far, the squared residuals above it are not gathered.
+*/
+void scoreHypotheses(
+	const double* abcissa, const double* ordinate, size_t noOfPoints, size_t numberOfIterations, uint64_t seed,
+	std::atomic<size_t>& nextIteration, std::atomic<double>& bestMedian, WorkerResult& result)
+{
+	std::vector<double> squaredResiduals(noOfPoints);
+	size_t medianRank = noOfPoints / 2;
+	for (size_t firstIteration = nextIteration.fetch_add(iterationsPerBatch); firstIteration < numberOfIterations;
+		firstIteration = nextIteration.fetch_add(iterationsPerBatch))
+	{
+		size_t lastIteration = std::min(firstIteration + iterationsPerBatch, numberOfIterations);
+		for (size_t iteration = firstIteration; iteration < lastIteration; iteration++) {
+			LinearModel hypothesis;
+			if (!drawHypothesis(abcissa, ordinate, noOfPoints, seed, iteration, hypothesis)) {
+				continue;
+			}
+			// the squared residuals up to the bound are the smallest ones, the median is among them if there are enough,
+			// otherwise it is above the bound and the hypothesis cannot win
+			size_t numberOfGathered = gatherSquaredResiduals(
+				abcissa, ordinate, noOfPoints, hypothesis.getValueAt0(), hypothesis.getSlope(), bestMedian.load(), squaredResiduals.data());
+			if (numberOfGathered <= medianRank) {
+				continue;
+			}
+			auto median = squaredResiduals.begin() + static_cast<std::ptrdiff_t>(medianRank);
+			std::nth_element(squaredResiduals.begin(), median, squaredResiduals.begin() + static_cast<std::ptrdiff_t>(numberOfGathered));
+			result.numberOfMedianSelections++;
+
+			ScoredHypothesis scored{ hypothesis, *median, iteration };
+			if (scored.isBetterThan(result.best)) {
+				result.best = scored;
+				lowerBound(bestMedian, scored.medianOfSquaredResiduals);
+			}
+		}
+	}
+}
+
+} // namespace
+
+LeastMedianOfSquaresFitStrategy::LeastMedianOfSquaresFitStrategy(size_t numberOfIterations, int numberOfThreads, uint64_t randomSeed)
+	: _numberOfIterations{ numberOfIterations }, _randomSeed{ randomSeed }
+{
+	size_t resolvedNumberOfThreads = Core::ThreadPool::resolveNumberOfThreads(static_cast<size_t>(std::max(numberOfThreads, 0)));
+	if (resolvedNumberOfThreads > 1) {
+		_pThreadPool = std::make_shared<Core::ThreadPool>(resolvedNumberOfThreads);
+	}
+}
+
+LinearModel LeastMedianOfSquaresFitStrategy::fitLinearModel(ColumnView abcissa, ColumnView ordinate) {
+	return fitLinearModelWithReport(abcissa, ordinate).model;
+}
+
+LeastMedianOfSquaresFitReport LeastMedianOfSquaresFitStrategy::fitLinearModelWithReport(ColumnView abcissa, ColumnView ordinate) {
+	checkNoOfRows(abcissa, ordinate);
+	size_t noOfPoints = abcissa.getNoOfRows();
+	const double* abcissaValues = abcissa.data();
+	const double* ordinateValues = ordinate.data();
+	LeastMedianOfSquaresFitReport report;
+	report.inlierMask.reset(noOfPoints);
+	report.numberOfIterations = _numberOfIterations;
+	double notANumber = std::numeric_limits<double>::quiet_NaN();
+	report.model = LinearModel{ notANumber, notANumber };
+	if (noOfPoints < 2) {
+		return report;
+	}
+
+	std::atomic<size_t> nextIteration{ 0 };
+	std::atomic<double> bestMedian{ std::numeric_limits<double>::infinity() };
+	std::vector<WorkerResult> workerResults(_pThreadPool ? _pThreadPool->getNumberOfThreads() : 1);
+	auto scoreOnWorker = [&](size_t worker) {
+		scoreHypotheses(abcissaValues, ordinateValues, noOfPoints, _numberOfIterations, _randomSeed, nextIteration, bestMedian, workerResults[worker]);
+	};
+	if (_pThreadPool) {
+		_pThreadPool->runOnEachThread(scoreOnWorker);
+	}
+	else {
+		scoreOnWorker(0);
+	}
+
+	ScoredHypothesis best;
+	for (const WorkerResult& workerResult : workerResults) {
+		report.numberOfMedianSelections += workerResult.numberOfMedianSelections;
+		if (workerResult.best.isBetterThan(best)) {
+			best = workerResult.best;
+		}
+	}
+	if (best.iteration == std::numeric_limits<size_t>::max()) {
+		return report;
+	}
+
+	// the median of the squared residuals of a normal sample, corrected for the small samples as by Rousseeuw and Leroy
+	double smallSampleCorrection = (noOfPoints > 2) ? 1.0 + 5.0 / static_cast<double>(noOfPoints - 2) : 1.0;
+	report.medianOfSquaredResiduals = best.medianOfSquaredResiduals;
+	report.robustScale = normalConsistencyFactor * smallSampleCorrection * std::sqrt(best.medianOfSquaredResiduals);
+	// the mask keeps |residual| <= cutoff * scale, a zero scale keeps the data points lying exactly on the line
+	double threshold = std::nextafter(refinementCutoff * report.robustScale, std::numeric_limits<double>::infinity());
+	report.numberOfInliers = countInliers(
+		abcissaValues, ordinateValues, noOfPoints, best.model.getValueAt0(), best.model.getSlope(), threshold, report.inlierMask.getWords());
+	report.model = best.model;
+	LinearModel refinedModel = fitLeastSquaresOnInliers(abcissaValues, ordinateValues, report.inlierMask);
+	if (std::isfinite(refinedModel.getSlope()) && std::isfinite(refinedModel.getValueAt0())) {
+		report.model = refinedModel;
+	}
+	return report;
+}
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
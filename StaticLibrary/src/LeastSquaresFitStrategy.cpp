@@ -12,31 +12,130 @@
 // limitations under the License.
 
 #include "LeastSquaresFitStrategy.h"
+#include "LeastSquaresKernel.h"
 #include "LinearModel.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
 using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
 using Column = ConsoleAppRansacIINamespace::Core::Column;
 
 namespace ConsoleAppRansacIINamespace {
 namespace Fitting {
 
-LinearModel LeastSquaresFitStrategy::fitLinearModel(const Column& abcissa, const Column& ordinate) {
-	LinearModel model;
-	double abcissaAverage = abcissa.getAverage();
-	double ordinateAverage = ordinate.getAverage();
-
-	double numerator = 0;
-	double denominator = 0;
-	size_t sharedNumberOfRows = abcissa.getNoOfRows();
-	for (size_t sharedIndex = 0; sharedIndex < sharedNumberOfRows; sharedIndex++) {
-		double abcissaCentralMoment = abcissa.getOneRow(sharedIndex) - abcissaAverage;
-		double ordinateCentralMoment = ordinate.getOneRow(sharedIndex) - ordinateAverage;
-		numerator += abcissaCentralMoment * ordinateCentralMoment;
-		denominator += abcissaCentralMoment * abcissaCentralMoment;
+namespace {
+
+/**
+* @brief Accumulate the statistics of the fixed chunks, each into its own slot, and merge them by a fixed pairwise tree.
+* @param accumulateChunk The callable taking the index of the worker, the first point and the length of a chunk.
+*/
+LinearSufficientStats reduceChunks(
+	size_t noOfPoints, Core::ThreadPool* pThreadPool,
+	const std::function<LinearSufficientStats(size_t, size_t, size_t)>& accumulateChunk)
+{
+	constexpr size_t chunkSize = LeastSquaresFitStrategy::chunkSize;
+	size_t numberOfChunks = (noOfPoints + chunkSize - 1) / chunkSize;
+	if (numberOfChunks <= 1) {
+		return accumulateChunk(0, 0, noOfPoints);
+	}
+
+	std::vector<LinearSufficientStats> chunkStats(numberOfChunks);
+	auto accumulateChunkIntoSlot = [&](size_t worker, size_t chunk) {
+		size_t firstPoint = chunk * chunkSize;
+		size_t chunkLength = std::min(chunkSize, noOfPoints - firstPoint);
+		chunkStats[chunk] = accumulateChunk(worker, firstPoint, chunkLength);
+	};
+	if (pThreadPool != nullptr) {
+		// the chunks are handed out one by one, each result has its own slot
+		std::atomic<size_t> nextChunk{ 0 };
+		pThreadPool->runOnEachThread([&](size_t worker) {
+			for (size_t chunk = nextChunk++; chunk < numberOfChunks; chunk = nextChunk++) {
+				accumulateChunkIntoSlot(worker, chunk);
+			}
+		});
+	}
+	else {
+		for (size_t chunk = 0; chunk < numberOfChunks; chunk++) {
+			accumulateChunkIntoSlot(0, chunk);
+		}
+	}
+
+	// the pairwise tree: the neighbours at the distance 1, 2, 4, ... are merged into the left one
+	for (size_t distance = 1; distance < numberOfChunks; distance *= 2) {
+		for (size_t chunk = 0; chunk + distance < numberOfChunks; chunk += 2 * distance) {
+			chunkStats[chunk].merge(chunkStats[chunk + distance]);
+		}
 	}
-	model.setSlope(numerator / denominator);
-	model.setYIntercept(ordinateAverage - model.getSlope() * abcissaAverage);
-	return model;
+	return chunkStats[0];
+}
+
+/**
+* @brief Accumulate the statistics of one chunk, in two scalar passes if the whole input is small.
+* @param noOfPoints The number of the data points of the whole input.
+*/
+template <typename T>
+LinearSufficientStats accumulateChunk(const T* abcissa, const T* ordinate, size_t chunkLength, size_t noOfPoints) {
+	if (noOfPoints <= LeastSquaresFitStrategy::twoPassMaxNoOfPoints) {
+		return accumulateLinearSufficientStatsInTwoPasses(abcissa, ordinate, chunkLength);
+	}
+	return accumulateLinearSufficientStats(abcissa, ordinate, chunkLength);
+}
+
+} // namespace
+
+LeastSquaresFitStrategy::LeastSquaresFitStrategy(int numberOfThreads) {
+	size_t resolvedNumberOfThreads = Core::ThreadPool::resolveNumberOfThreads(static_cast<size_t>(std::max(numberOfThreads, 0)));
+	if (resolvedNumberOfThreads > 1) {
+		_pThreadPool = std::make_shared<Core::ThreadPool>(resolvedNumberOfThreads);
+	}
+}
+
+LinearModel LeastSquaresFitStrategy::fitLinearModel(ColumnView abcissa, ColumnView ordinate) {
+	checkNoOfRows(abcissa, ordinate);
+	// one vectorized pass over the contiguous values of both columns
+	return accumulate(abcissa.data(), ordinate.data(), abcissa.getNoOfRows()).fit();
+}
+
+LinearSufficientStats LeastSquaresFitStrategy::accumulate(const double* abcissa, const double* ordinate, size_t noOfPoints) const {
+	return reduceChunks(noOfPoints, _pThreadPool.get(), [&](size_t, size_t firstPoint, size_t chunkLength) {
+		return accumulateChunk(abcissa + firstPoint, ordinate + firstPoint, chunkLength, noOfPoints);
+	});
+}
+
+template <typename T>
+LinearSufficientStats LeastSquaresFitStrategy::accumulate(const T* abcissa, const T* ordinate, size_t noOfPoints) const {
+	return reduceChunks(noOfPoints, _pThreadPool.get(), [&](size_t, size_t firstPoint, size_t chunkLength) {
+		return accumulateChunk(abcissa + firstPoint, ordinate + firstPoint, chunkLength, noOfPoints);
+	});
+}
+
+template LinearSufficientStats LeastSquaresFitStrategy::accumulate(const float*, const float*, size_t) const;
+template LinearSufficientStats LeastSquaresFitStrategy::accumulate(const int32_t*, const int32_t*, size_t) const;
+template LinearSufficientStats LeastSquaresFitStrategy::accumulate(const int64_t*, const int64_t*, size_t) const;
+
+LinearModel LeastSquaresFitStrategy::fitLinearModel(const Core::ColumnSelection& abcissa, const Core::ColumnSelection& ordinate) {
+	return accumulate(abcissa, ordinate).fit();
+}
+
+LinearSufficientStats LeastSquaresFitStrategy::accumulate(const Core::ColumnSelection& abcissa, const Core::ColumnSelection& ordinate) const {
+	checkNoOfRows(abcissa, ordinate);
+	size_t noOfPoints = abcissa.getNoOfRows();
+	size_t numberOfWorkers = _pThreadPool ? _pThreadPool->getNumberOfThreads() : 1;
+	size_t bufferSize = std::min(chunkSize, noOfPoints);
+	std::vector<std::vector<double>> abcissaBuffers(numberOfWorkers);
+	std::vector<std::vector<double>> ordinateBuffers(numberOfWorkers);
+	return reduceChunks(noOfPoints, _pThreadPool.get(), [&](size_t worker, size_t firstPoint, size_t chunkLength) {
+		// the chunks are the same as the ones of the materialized selections, so are the statistics
+		abcissaBuffers[worker].resize(bufferSize);
+		ordinateBuffers[worker].resize(bufferSize);
+		abcissa.materialize(firstPoint, chunkLength, abcissaBuffers[worker].data());
+		ordinate.materialize(firstPoint, chunkLength, ordinateBuffers[worker].data());
+		return accumulateChunk(abcissaBuffers[worker].data(), ordinateBuffers[worker].data(), chunkLength, noOfPoints);
+	});
 }
 
 } // namespace Fitting
@@ -0,0 +1,485 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "LeastSquaresKernel.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(RANSAC_III_X86_64_KERNELS)
+#include <immintrin.h>
+#endif
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+namespace {
+
+template <typename T>
+using AccumulateStatsKernel = LinearSufficientStats(*)(const T*, const T*, size_t);
+
+/**
+* @brief Get the deviation of a value from the shift value in double.
+* @note The float and the 32 bit integer values convert to double exactly, so do their differences.
+*/
+template <typename T>
+inline double deviationFrom(T value, T shift) {
+	return static_cast<double>(value) - static_cast<double>(shift);
+}
+
+/**
+* @brief Get the deviation of a 64 bit integer value from the shift value in double.
+* @note The difference is taken in the integers, so the large values, e.g. the timestamps in nanoseconds,
+* keep all the digits of their differences which a conversion of the values to double would lose.
+*/
+inline double deviationFrom(int64_t value, int64_t shift) {
+	return static_cast<double>(static_cast<int64_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(shift)));
+}
+
+/**
+* @brief Get the value the two-pass deviations are taken from, zero keeps the operations of the fit before the kernel.
+*/
+template <typename T>
+inline T getTwoPassShift(const T*) {
+	return T{ 0 };
+}
+
+/**
+* @brief Get the first of the 64 bit integer values, so the two passes take their differences in the integers as the kernels do.
+*/
+inline int64_t getTwoPassShift(const int64_t* values) {
+	return values[0];
+}
+
+/**
+* @brief A sum with the Kahan compensation of the rounding errors.
+*/
+struct CompensatedSum {
+	double sum = 0.0;
+	double compensation = 0.0;
+
+	void add(double value) {
+		double correctedValue = value - compensation;
+		double newSum = sum + correctedValue;
+		compensation = (newSum - sum) - correctedValue;
+		sum = newSum;
+	}
+};
+
+/**
+* @brief The number of the accumulated sums: x, y, x * x, x * y and y * y of the deviations.
+*/
+constexpr size_t numberOfMoments = 5;
+
+/**
+* @brief The number of the lanes of the compensated sums, the same for every instruction set.
+* @note The data point of the index goes to the lane (index % numberOfLanes) and the lanes are added in the lane order,
+* so the rounding and the statistics do not depend on the instruction set. SSE2 keeps the lanes in four registers,
+* AVX2 in two and AVX-512 in one.
+*/
+constexpr size_t numberOfLanes = 8;
+
+/**
+* @brief The compensated sums of the deviations from the shift point and of their products.
+*/
+struct ShiftedSums {
+	CompensatedSum moments[numberOfMoments];
+
+	void add(double abcissaDeviation, double ordinateDeviation) {
+		moments[0].add(abcissaDeviation);
+		moments[1].add(ordinateDeviation);
+		moments[2].add(abcissaDeviation * abcissaDeviation);
+		moments[3].add(abcissaDeviation * ordinateDeviation);
+		moments[4].add(ordinateDeviation * ordinateDeviation);
+	}
+
+	/**
+	* @brief Add the sums and the compensations of the SIMD lanes of a moment in the lane order.
+	*/
+	void addLanes(size_t moment, const double* laneSums, const double* laneCompensations, size_t noOfLanes) {
+		for (size_t lane = 0; lane < noOfLanes; lane++) {
+			moments[moment].add(laneSums[lane]);
+			moments[moment].add(-laneCompensations[lane]);
+		}
+	}
+
+	/**
+	* @brief Centre the sums at the means of the data points.
+	*/
+	LinearSufficientStats getStats(size_t noOfPoints, double abcissaShift, double ordinateShift) const {
+		double count = static_cast<double>(noOfPoints);
+		double abcissaSum = moments[0].sum;
+		double ordinateSum = moments[1].sum;
+		double abcissaMeanDeviation = abcissaSum / count;
+		double ordinateMeanDeviation = ordinateSum / count;
+		return LinearSufficientStats::fromCentralMoments(
+			noOfPoints,
+			abcissaShift + abcissaMeanDeviation,
+			ordinateShift + ordinateMeanDeviation,
+			std::max(moments[2].sum - abcissaSum * abcissaMeanDeviation, 0.0),
+			moments[3].sum - abcissaSum * ordinateMeanDeviation,
+			std::max(moments[4].sum - ordinateSum * ordinateMeanDeviation, 0.0));
+	}
+};
+
+template <typename T>
+LinearSufficientStats accumulateStatsScalar(const T* abcissa, const T* ordinate, size_t noOfPoints) {
+	if (noOfPoints == 0) {
+		return LinearSufficientStats{};
+	}
+	// the deviations from the first data point keep the squares small when the data are far from the origin
+	T abcissaShift = abcissa[0];
+	T ordinateShift = ordinate[0];
+	ShiftedSums laneSums[numberOfLanes];
+	size_t vectorizedPoints = noOfPoints - noOfPoints % numberOfLanes;
+	for (size_t index = 0; index < vectorizedPoints; index += numberOfLanes) {
+		for (size_t lane = 0; lane < numberOfLanes; lane++) {
+			laneSums[lane].add(
+				deviationFrom(abcissa[index + lane], abcissaShift), deviationFrom(ordinate[index + lane], ordinateShift));
+		}
+	}
+	ShiftedSums shiftedSums;
+	double sums[numberOfLanes];
+	double compensations[numberOfLanes];
+	for (size_t moment = 0; moment < numberOfMoments; moment++) {
+		for (size_t lane = 0; lane < numberOfLanes; lane++) {
+			sums[lane] = laneSums[lane].moments[moment].sum;
+			compensations[lane] = laneSums[lane].moments[moment].compensation;
+		}
+		shiftedSums.addLanes(moment, sums, compensations, numberOfLanes);
+	}
+	for (size_t index = vectorizedPoints; index < noOfPoints; index++) {
+		shiftedSums.add(deviationFrom(abcissa[index], abcissaShift), deviationFrom(ordinate[index], ordinateShift));
+	}
+	return shiftedSums.getStats(noOfPoints, static_cast<double>(abcissaShift), static_cast<double>(ordinateShift));
+}
+
+#if defined(RANSAC_III_X86_64_KERNELS)
+
+inline void compensatedAddSSE2(__m128d& sum, __m128d& compensation, __m128d value) {
+	__m128d correctedValue = _mm_sub_pd(value, compensation);
+	__m128d newSum = _mm_add_pd(sum, correctedValue);
+	compensation = _mm_sub_pd(_mm_sub_pd(newSum, sum), correctedValue);
+	sum = newSum;
+}
+
+/**
+* @brief Load the deviations of two values from the shift value as doubles.
+*/
+inline __m128d loadDeviationsSSE2(const double* values, double shift) {
+	return _mm_sub_pd(_mm_loadu_pd(values), _mm_set1_pd(shift));
+}
+
+inline __m128d loadDeviationsSSE2(const float* values, float shift) {
+	__m128 loadedValues = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)));
+	return _mm_sub_pd(_mm_cvtps_pd(loadedValues), _mm_set1_pd(static_cast<double>(shift)));
+}
+
+inline __m128d loadDeviationsSSE2(const int32_t* values, int32_t shift) {
+	__m128i loadedValues = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values));
+	return _mm_sub_pd(_mm_cvtepi32_pd(loadedValues), _mm_set1_pd(static_cast<double>(shift)));
+}
+
+inline __m128d loadDeviationsSSE2(const int64_t* values, int64_t shift) {
+	return _mm_set_pd(deviationFrom(values[1], shift), deviationFrom(values[0], shift));
+}
+
+template <typename T>
+LinearSufficientStats accumulateStatsSSE2(const T* abcissa, const T* ordinate, size_t noOfPoints) {
+	if (noOfPoints == 0) {
+		return LinearSufficientStats{};
+	}
+	T abcissaShift = abcissa[0];
+	T ordinateShift = ordinate[0];
+	constexpr size_t numberOfParts = numberOfLanes / 2;
+	__m128d sums[numberOfMoments][numberOfParts];
+	__m128d compensations[numberOfMoments][numberOfParts];
+	for (size_t moment = 0; moment < numberOfMoments; moment++) {
+		for (size_t part = 0; part < numberOfParts; part++) {
+			sums[moment][part] = _mm_setzero_pd();
+			compensations[moment][part] = _mm_setzero_pd();
+		}
+	}
+	size_t vectorizedPoints = noOfPoints - noOfPoints % numberOfLanes;
+	for (size_t index = 0; index < vectorizedPoints; index += numberOfLanes) {
+		for (size_t part = 0; part < numberOfParts; part++) {
+			__m128d abcissaDeviations = loadDeviationsSSE2(abcissa + index + 2 * part, abcissaShift);
+			__m128d ordinateDeviations = loadDeviationsSSE2(ordinate + index + 2 * part, ordinateShift);
+			compensatedAddSSE2(sums[0][part], compensations[0][part], abcissaDeviations);
+			compensatedAddSSE2(sums[1][part], compensations[1][part], ordinateDeviations);
+			compensatedAddSSE2(sums[2][part], compensations[2][part], _mm_mul_pd(abcissaDeviations, abcissaDeviations));
+			compensatedAddSSE2(sums[3][part], compensations[3][part], _mm_mul_pd(abcissaDeviations, ordinateDeviations));
+			compensatedAddSSE2(sums[4][part], compensations[4][part], _mm_mul_pd(ordinateDeviations, ordinateDeviations));
+		}
+	}
+	ShiftedSums shiftedSums;
+	double laneSums[numberOfLanes];
+	double laneCompensations[numberOfLanes];
+	for (size_t moment = 0; moment < numberOfMoments; moment++) {
+		for (size_t part = 0; part < numberOfParts; part++) {
+			_mm_storeu_pd(laneSums + 2 * part, sums[moment][part]);
+			_mm_storeu_pd(laneCompensations + 2 * part, compensations[moment][part]);
+		}
+		shiftedSums.addLanes(moment, laneSums, laneCompensations, numberOfLanes);
+	}
+	for (size_t index = vectorizedPoints; index < noOfPoints; index++) {
+		shiftedSums.add(deviationFrom(abcissa[index], abcissaShift), deviationFrom(ordinate[index], ordinateShift));
+	}
+	return shiftedSums.getStats(noOfPoints, static_cast<double>(abcissaShift), static_cast<double>(ordinateShift));
+}
+
+RANSAC_III_TARGET_AVX2
+inline void compensatedAddAVX2(__m256d& sum, __m256d& compensation, __m256d value) {
+	__m256d correctedValue = _mm256_sub_pd(value, compensation);
+	__m256d newSum = _mm256_add_pd(sum, correctedValue);
+	compensation = _mm256_sub_pd(_mm256_sub_pd(newSum, sum), correctedValue);
+	sum = newSum;
+}
+
+/**
+* @brief Load the deviations of four values from the shift value as doubles.
+*/
+RANSAC_III_TARGET_AVX2
+inline __m256d loadDeviationsAVX2(const double* values, double shift) {
+	return _mm256_sub_pd(_mm256_loadu_pd(values), _mm256_set1_pd(shift));
+}
+
+RANSAC_III_TARGET_AVX2
+inline __m256d loadDeviationsAVX2(const float* values, float shift) {
+	return _mm256_sub_pd(_mm256_cvtps_pd(_mm_loadu_ps(values)), _mm256_set1_pd(static_cast<double>(shift)));
+}
+
+RANSAC_III_TARGET_AVX2
+inline __m256d loadDeviationsAVX2(const int32_t* values, int32_t shift) {
+	__m128i loadedValues = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+	return _mm256_sub_pd(_mm256_cvtepi32_pd(loadedValues), _mm256_set1_pd(static_cast<double>(shift)));
+}
+
+// AVX2 has no conversion of the 64 bit integers to double, the lanes are converted one by one
+RANSAC_III_TARGET_AVX2
+inline __m256d loadDeviationsAVX2(const int64_t* values, int64_t shift) {
+	return _mm256_set_pd(
+		deviationFrom(values[3], shift), deviationFrom(values[2], shift),
+		deviationFrom(values[1], shift), deviationFrom(values[0], shift));
+}
+
+template <typename T>
+RANSAC_III_TARGET_AVX2
+LinearSufficientStats accumulateStatsAVX2(const T* abcissa, const T* ordinate, size_t noOfPoints) {
+	if (noOfPoints == 0) {
+		return LinearSufficientStats{};
+	}
+	T abcissaShift = abcissa[0];
+	T ordinateShift = ordinate[0];
+	constexpr size_t numberOfParts = numberOfLanes / 4;
+	__m256d sums[numberOfMoments][numberOfParts];
+	__m256d compensations[numberOfMoments][numberOfParts];
+	for (size_t moment = 0; moment < numberOfMoments; moment++) {
+		for (size_t part = 0; part < numberOfParts; part++) {
+			sums[moment][part] = _mm256_setzero_pd();
+			compensations[moment][part] = _mm256_setzero_pd();
+		}
+	}
+	size_t vectorizedPoints = noOfPoints - noOfPoints % numberOfLanes;
+	for (size_t index = 0; index < vectorizedPoints; index += numberOfLanes) {
+		for (size_t part = 0; part < numberOfParts; part++) {
+			__m256d abcissaDeviations = loadDeviationsAVX2(abcissa + index + 4 * part, abcissaShift);
+			__m256d ordinateDeviations = loadDeviationsAVX2(ordinate + index + 4 * part, ordinateShift);
+			compensatedAddAVX2(sums[0][part], compensations[0][part], abcissaDeviations);
+			compensatedAddAVX2(sums[1][part], compensations[1][part], ordinateDeviations);
+			compensatedAddAVX2(sums[2][part], compensations[2][part], _mm256_mul_pd(abcissaDeviations, abcissaDeviations));
+			compensatedAddAVX2(sums[3][part], compensations[3][part], _mm256_mul_pd(abcissaDeviations, ordinateDeviations));
+			compensatedAddAVX2(sums[4][part], compensations[4][part], _mm256_mul_pd(ordinateDeviations, ordinateDeviations));
+		}
+	}
+	ShiftedSums shiftedSums;
+	double laneSums[numberOfLanes];
+	double laneCompensations[numberOfLanes];
+	for (size_t moment = 0; moment < numberOfMoments; moment++) {
+		for (size_t part = 0; part < numberOfParts; part++) {
+			_mm256_storeu_pd(laneSums + 4 * part, sums[moment][part]);
+			_mm256_storeu_pd(laneCompensations + 4 * part, compensations[moment][part]);
+		}
+		shiftedSums.addLanes(moment, laneSums, laneCompensations, numberOfLanes);
+	}
+	for (size_t index = vectorizedPoints; index < noOfPoints; index++) {
+		shiftedSums.add(deviationFrom(abcissa[index], abcissaShift), deviationFrom(ordinate[index], ordinateShift));
+	}
+	return shiftedSums.getStats(noOfPoints, static_cast<double>(abcissaShift), static_cast<double>(ordinateShift));
+}
+
+RANSAC_III_TARGET_AVX512
+inline void compensatedAddAVX512(__m512d& sum, __m512d& compensation, __m512d value) {
+	__m512d correctedValue = _mm512_sub_pd(value, compensation);
+	__m512d newSum = _mm512_add_pd(sum, correctedValue);
+	compensation = _mm512_sub_pd(_mm512_sub_pd(newSum, sum), correctedValue);
+	sum = newSum;
+}
+
+/**
+* @brief Load the deviations of eight values from the shift value as doubles.
+*/
+RANSAC_III_TARGET_AVX512
+inline __m512d loadDeviationsAVX512(const double* values, double shift) {
+	return _mm512_sub_pd(_mm512_loadu_pd(values), _mm512_set1_pd(shift));
+}
+
+RANSAC_III_TARGET_AVX512
+inline __m512d loadDeviationsAVX512(const float* values, float shift) {
+	// the zero-masked conversions, the unmasked ones start from _mm512_undefined_pd which GCC 12 reports as uninitialized
+	return _mm512_sub_pd(_mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(values)), _mm512_set1_pd(static_cast<double>(shift)));
+}
+
+RANSAC_III_TARGET_AVX512
+inline __m512d loadDeviationsAVX512(const int32_t* values, int32_t shift) {
+	__m256i loadedValues = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+	return _mm512_sub_pd(_mm512_maskz_cvtepi32_pd(0xFF, loadedValues), _mm512_set1_pd(static_cast<double>(shift)));
+}
+
+// the conversion of the 64 bit integers to double needs AVX-512DQ, the lanes are converted one by one
+RANSAC_III_TARGET_AVX512
+inline __m512d loadDeviationsAVX512(const int64_t* values, int64_t shift) {
+	alignas(64) double deviations[8];
+	for (size_t lane = 0; lane < 8; lane++) {
+		deviations[lane] = deviationFrom(values[lane], shift);
+	}
+	return _mm512_load_pd(deviations);
+}
+
+template <typename T>
+RANSAC_III_TARGET_AVX512
+LinearSufficientStats accumulateStatsAVX512(const T* abcissa, const T* ordinate, size_t noOfPoints) {
+	if (noOfPoints == 0) {
+		return LinearSufficientStats{};
+	}
+	T abcissaShift = abcissa[0];
+	T ordinateShift = ordinate[0];
+	__m512d sums[numberOfMoments];
+	__m512d compensations[numberOfMoments];
+	for (size_t moment = 0; moment < numberOfMoments; moment++) {
+		sums[moment] = _mm512_setzero_pd();
+		compensations[moment] = _mm512_setzero_pd();
+	}
+	size_t vectorizedPoints = noOfPoints - noOfPoints % numberOfLanes;
+	for (size_t index = 0; index < vectorizedPoints; index += numberOfLanes) {
+		__m512d abcissaDeviations = loadDeviationsAVX512(abcissa + index, abcissaShift);
+		__m512d ordinateDeviations = loadDeviationsAVX512(ordinate + index, ordinateShift);
+		compensatedAddAVX512(sums[0], compensations[0], abcissaDeviations);
+		compensatedAddAVX512(sums[1], compensations[1], ordinateDeviations);
+		compensatedAddAVX512(sums[2], compensations[2], _mm512_mul_pd(abcissaDeviations, abcissaDeviations));
+		compensatedAddAVX512(sums[3], compensations[3], _mm512_mul_pd(abcissaDeviations, ordinateDeviations));
+		compensatedAddAVX512(sums[4], compensations[4], _mm512_mul_pd(ordinateDeviations, ordinateDeviations));
+	}
+	ShiftedSums shiftedSums;
+	double laneSums[numberOfLanes];
+	double laneCompensations[numberOfLanes];
+	for (size_t moment = 0; moment < numberOfMoments; moment++) {
+		_mm512_storeu_pd(laneSums, sums[moment]);
+		_mm512_storeu_pd(laneCompensations, compensations[moment]);
+		shiftedSums.addLanes(moment, laneSums, laneCompensations, numberOfLanes);
+	}
+	for (size_t index = vectorizedPoints; index < noOfPoints; index++) {
+		shiftedSums.add(deviationFrom(abcissa[index], abcissaShift), deviationFrom(ordinate[index], ordinateShift));
+	}
+	return shiftedSums.getStats(noOfPoints, static_cast<double>(abcissaShift), static_cast<double>(ordinateShift));
+}
+
+#endif
+
+template <typename T>
+AccumulateStatsKernel<T> getKernel(Core::InstructionSet instructionSet) {
+	switch (instructionSet) {
+#if defined(RANSAC_III_X86_64_KERNELS)
+	case Core::InstructionSet::AVX512:
+		return &accumulateStatsAVX512<T>;
+	case Core::InstructionSet::AVX2:
+		return &accumulateStatsAVX2<T>;
+	case Core::InstructionSet::SSE2:
+		return &accumulateStatsSSE2<T>;
+#endif
+	default:
+		return &accumulateStatsScalar<T>;
+	}
+}
+
+} // namespace
+
+LinearSufficientStats accumulateLinearSufficientStats(const double* abcissa, const double* ordinate, size_t noOfPoints) {
+	return accumulateLinearSufficientStats<double>(abcissa, ordinate, noOfPoints);
+}
+
+LinearSufficientStats accumulateLinearSufficientStats(
+	Core::InstructionSet instructionSet, const double* abcissa, const double* ordinate, size_t noOfPoints)
+{
+	return accumulateLinearSufficientStats<double>(instructionSet, abcissa, ordinate, noOfPoints);
+}
+
+template <typename T>
+LinearSufficientStats accumulateLinearSufficientStats(const T* abcissa, const T* ordinate, size_t noOfPoints) {
+	static const AccumulateStatsKernel<T> selectedKernel = getKernel<T>(Core::getBestSupportedInstructionSet());
+	return selectedKernel(abcissa, ordinate, noOfPoints);
+}
+
+template <typename T>
+LinearSufficientStats accumulateLinearSufficientStats(
+	Core::InstructionSet instructionSet, const T* abcissa, const T* ordinate, size_t noOfPoints)
+{
+	return getKernel<T>(instructionSet)(abcissa, ordinate, noOfPoints);
+}
+
+template <typename T>
+LinearSufficientStats accumulateLinearSufficientStatsInTwoPasses(const T* abcissa, const T* ordinate, size_t noOfPoints) {
+	if (noOfPoints == 0) {
+		return LinearSufficientStats{};
+	}
+	// the means are the ones of the deviations from the shifts, the shifts are zero except for the 64 bit integers
+	T abcissaShift = getTwoPassShift(abcissa);
+	T ordinateShift = getTwoPassShift(ordinate);
+	double abcissaMean = 0;
+	double ordinateMean = 0;
+	for (size_t index = 0; index < noOfPoints; index++) {
+		double count = static_cast<double>(index + 1);
+		abcissaMean += (deviationFrom(abcissa[index], abcissaShift) - abcissaMean) / count;
+		ordinateMean += (deviationFrom(ordinate[index], ordinateShift) - ordinateMean) / count;
+	}
+	double abcissaComoment = 0;
+	double crossComoment = 0;
+	double ordinateComoment = 0;
+	for (size_t index = 0; index < noOfPoints; index++) {
+		double abcissaDeviation = deviationFrom(abcissa[index], abcissaShift) - abcissaMean;
+		double ordinateDeviation = deviationFrom(ordinate[index], ordinateShift) - ordinateMean;
+		crossComoment += abcissaDeviation * ordinateDeviation;
+		abcissaComoment += abcissaDeviation * abcissaDeviation;
+		ordinateComoment += ordinateDeviation * ordinateDeviation;
+	}
+	return LinearSufficientStats::fromCentralMoments(
+		noOfPoints, static_cast<double>(abcissaShift) + abcissaMean, static_cast<double>(ordinateShift) + ordinateMean,
+		abcissaComoment, crossComoment, ordinateComoment);
+}
+
+template LinearSufficientStats accumulateLinearSufficientStatsInTwoPasses(const double*, const double*, size_t);
+template LinearSufficientStats accumulateLinearSufficientStatsInTwoPasses(const float*, const float*, size_t);
+template LinearSufficientStats accumulateLinearSufficientStatsInTwoPasses(const int32_t*, const int32_t*, size_t);
+template LinearSufficientStats accumulateLinearSufficientStatsInTwoPasses(const int64_t*, const int64_t*, size_t);
+
+template LinearSufficientStats accumulateLinearSufficientStats(const float*, const float*, size_t);
+template LinearSufficientStats accumulateLinearSufficientStats(const int32_t*, const int32_t*, size_t);
+template LinearSufficientStats accumulateLinearSufficientStats(const int64_t*, const int64_t*, size_t);
+
+template LinearSufficientStats accumulateLinearSufficientStats(Core::InstructionSet, const float*, const float*, size_t);
+template LinearSufficientStats accumulateLinearSufficientStats(Core::InstructionSet, const int32_t*, const int32_t*, size_t);
+template LinearSufficientStats accumulateLinearSufficientStats(Core::InstructionSet, const int64_t*, const int64_t*, size_t);
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
@@ -13,6 +13,7 @@
 
 #include <limits>
 #include <set>
+#include <string>
 #include "LinearModel.h"
 
 
@@ -39,29 +40,60 @@ bool LinearModel::isEqualTo(const LinearModel& other) const {
 	return (_yInterceptAlpha == other.getValueAt0()) && (_slopeBeta == other.getSlope());
 }
 
-double LinearModel::getValueAt(const double& abcissa) {
+double LinearModel::getValueAt(const double& abcissa) const {
 	return _yInterceptAlpha + _slopeBeta * abcissa;
 }
 
-vector<double> LinearModel::getMultipleValuesAt(const vector<double>& abcisses) {
-	// Dependency inversion principle broken?
-	vector<double> result;
-	for (size_t index = 0; index < abcisses.size(); index++) {
-		result.push_back(getValueAt(abcisses.at(index)));
-	}
+vector<double> LinearModel::getMultipleValuesAt(const vector<double>& abcisses) const {
+	vector<double> result(abcisses.size());
+	evaluate(abcisses.data(), abcisses.size(), result.data());
 	return result;
 }
 
-double LinearModel::sumOfSquaredResiduals(const Column& abcissa, const Column& ordinate) {
-	double cummulativeSquare = 0;
-	for (size_t sharedIndex = 0; sharedIndex < abcissa.getNoOfRows(); sharedIndex++) {
-		vector<double> modelValueX;
-		modelValueX.push_back(abcissa.getOneRow(sharedIndex));
-		vector<double> modelValueY = this->getMultipleValuesAt(modelValueX);
-		double Y = ordinate.getOneRow(sharedIndex);
-		cummulativeSquare += (modelValueY.at(0) - Y) * (modelValueY.at(0) - Y);
+double LinearModel::sumOfSquaredResiduals(const Column& abcissa, const Column& ordinate) const {
+	if (abcissa.getNoOfRows() != ordinate.getNoOfRows()) {
+		std::string exceptionMessage{ "The abcissa and the ordinate have different numbers of rows |" };
+		exceptionMessage.append(" Column name: ").append(abcissa.getHeader()).append(" Rows: ").append(std::to_string(abcissa.getNoOfRows()));
+		exceptionMessage.append(" Column name: ").append(ordinate.getHeader()).append(" Rows: ").append(std::to_string(ordinate.getNoOfRows()));
+		throw DifferentNoOfRows(exceptionMessage);
+	}
+	return sumOfSquaredResiduals(abcissa.getData(), ordinate.getData(), abcissa.getNoOfRows());
+}
+
+void LinearModel::evaluate(const double* abcisses, size_t noOfPoints, double* values) const {
+	// the coefficients are copied, the stores through values could otherwise alias them and force a reload per point
+	const double yIntercept = _yInterceptAlpha;
+	const double slope = _slopeBeta;
+	for (size_t index = 0; index < noOfPoints; index++) {
+		values[index] = yIntercept + slope * abcisses[index];
+	}
+}
+
+void LinearModel::residuals(const double* abcissa, const double* ordinate, size_t noOfPoints, double* residuals) const {
+	const double yIntercept = _yInterceptAlpha;
+	const double slope = _slopeBeta;
+	for (size_t index = 0; index < noOfPoints; index++) {
+		residuals[index] = (yIntercept + slope * abcissa[index]) - ordinate[index];
+	}
+}
+
+double LinearModel::sumOfSquaredResiduals(const double* abcissa, const double* ordinate, size_t noOfPoints) const {
+	constexpr size_t numberOfPartialSums = 4;
+	const double yIntercept = _yInterceptAlpha;
+	const double slope = _slopeBeta;
+	double partialSums[numberOfPartialSums] = {};
+	size_t index = 0;
+	for (; index + numberOfPartialSums <= noOfPoints; index += numberOfPartialSums) {
+		for (size_t lane = 0; lane < numberOfPartialSums; lane++) {
+			double residual = (yIntercept + slope * abcissa[index + lane]) - ordinate[index + lane];
+			partialSums[lane] += residual * residual;
+		}
+	}
+	for (; index < noOfPoints; index++) {
+		double residual = (yIntercept + slope * abcissa[index]) - ordinate[index];
+		partialSums[0] += residual * residual;
 	}
-	return cummulativeSquare;
+	return (partialSums[0] + partialSums[1]) + (partialSums[2] + partialSums[3]);
 }
 
 } // namespace Core
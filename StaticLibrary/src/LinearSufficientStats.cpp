@@ -0,0 +1,77 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "LinearSufficientStats.h"
+
+#include <algorithm>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+void LinearSufficientStats::remove(double abcissa, double ordinate) {
+	if (_noOfPoints <= 1) {
+		*this = LinearSufficientStats{};
+		return;
+	}
+	// the add recurrences run backwards: the means without the point first, then the co-moments
+	double remainingCount = static_cast<double>(_noOfPoints - 1);
+	double abcissaMean = _abcissaMean - (abcissa - _abcissaMean) / remainingCount;
+	double ordinateMean = _ordinateMean - (ordinate - _ordinateMean) / remainingCount;
+	_abcissaComoment -= (abcissa - abcissaMean) * (abcissa - _abcissaMean);
+	_crossComoment -= (abcissa - abcissaMean) * (ordinate - _ordinateMean);
+	_ordinateComoment -= (ordinate - ordinateMean) * (ordinate - _ordinateMean);
+	// the rounding must not make a sum of squares negative
+	_abcissaComoment = std::max(_abcissaComoment, 0.0);
+	_ordinateComoment = std::max(_ordinateComoment, 0.0);
+	_abcissaMean = abcissaMean;
+	_ordinateMean = ordinateMean;
+	_noOfPoints--;
+}
+
+void LinearSufficientStats::merge(const LinearSufficientStats& other) {
+	if (other._noOfPoints == 0) {
+		return;
+	}
+	if (_noOfPoints == 0) {
+		*this = other;
+		return;
+	}
+	double count = static_cast<double>(_noOfPoints);
+	double otherCount = static_cast<double>(other._noOfPoints);
+	double mergedCount = count + otherCount;
+	double abcissaShift = other._abcissaMean - _abcissaMean;
+	double ordinateShift = other._ordinateMean - _ordinateMean;
+	double weight = count * otherCount / mergedCount;
+	_abcissaComoment += other._abcissaComoment + abcissaShift * abcissaShift * weight;
+	_crossComoment += other._crossComoment + abcissaShift * ordinateShift * weight;
+	_ordinateComoment += other._ordinateComoment + ordinateShift * ordinateShift * weight;
+	_abcissaMean += abcissaShift * otherCount / mergedCount;
+	_ordinateMean += ordinateShift * otherCount / mergedCount;
+	_noOfPoints += other._noOfPoints;
+}
+
+LinearModel LinearSufficientStats::fit() const {
+	double slope = _crossComoment / _abcissaComoment;
+	return LinearModel{ _ordinateMean - slope * _abcissaMean, slope };
+}
+
+double LinearSufficientStats::getSumOfSquaredResiduals() const {
+	if (_abcissaComoment <= 0.0) {
+		return _ordinateComoment;
+	}
+	return std::max(_ordinateComoment - _crossComoment * _crossComoment / _abcissaComoment, 0.0);
+}
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
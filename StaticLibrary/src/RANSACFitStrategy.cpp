@@ -11,77 +11,202 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+
 #include "RANSACFitStrategy.h"
-#include "LeastSquaresFitStrategy.h"
+#include "RansacEngine.h"
+#include "RansacPolicies.h"
 
-#include <set>
 #include <random>
 #include <algorithm>
+#include <cmath>
 
 namespace ConsoleAppRansacIINamespace {
 namespace Fitting {
 
-RANSACParameters parameters{};
-
-
-
-LinearModel RANSACFitStrategy::fitLinearModel(const Column& abcissa, const Column& ordinate) {
-	int iterations = 0;
-	LinearModel bestModel;
-	double bestErr = std::numeric_limits<double>::max();
-
-	while (iterations < parameters.getNumberOfIterations()) {
-		vector<size_t> randomIndexesSample = 
-			//ConsoleAppRansacIINamespace::Core::getRandomIndexes(parameters.getNumberOfRandomSelectedPoints(), ordinate.getNoOfRows());
-		    getRandomIndexes(parameters.getNumberOfRandomSelectedPoints(), ordinate.getNoOfRows());
-		Column sampledAbcissa  = abcissa.getSpecifiedRows(randomIndexesSample);
-		Column sampledOrdinate = ordinate.getSpecifiedRows(randomIndexesSample);
-		//LinearModel maybeModel;
-		LeastSquaresFitStrategy maybeStrategy;
-		LinearModel maybeModel = maybeStrategy.fitLinearModel(sampledAbcissa, sampledOrdinate);
-		//maybeModel.fitModelByOrdinaryLeastSquares(sampledAbcissa, sampledOrdinate);
-
-		std::set<size_t, std::less<>> confirmedInliners;
-		for (size_t i = 0; i < abcissa.getNoOfRows(); i++) {
-			double modelValueX = abcissa.getOneRow(i);
-			double modelValueY = maybeModel.getValueAt(modelValueX);
-			double Y = ordinate.getOneRow(i);
-			if (abs(modelValueY - Y) < parameters.getTresholdValueToBeInlier()) {
-				confirmedInliners.insert(i);
-			}
+namespace {
+
+/**
+* @brief Run the engine with the scorer scoring in the classification pass and the refiner selected by the parameters.
+*/
+template <typename Model, typename Scorer>
+RansacEngineResult fitWithClassificationScorer(
+	const Model& model, const Scorer& scorer, const RANSACParameters& parameters,
+	const double* abcissa, const double* ordinate, size_t noOfPoints, const RansacEngineSettings& settings)
+{
+	if (parameters.isLocallyOptimized()) {
+		RansacEngine<Model, UniformSampler, Scorer, LocalOptimizationRefiner> engine{
+			model, UniformSampler{}, scorer, LocalOptimizationRefiner{ parameters.getLocalOptimizationSteps() } };
+		return engine.fit(abcissa, ordinate, noOfPoints, settings);
+	}
+	RansacEngine<Model, UniformSampler, Scorer, LeastSquaresRefiner> engine{ model, UniformSampler{}, scorer };
+	return engine.fit(abcissa, ordinate, noOfPoints, settings);
+}
+
+/**
+* @brief Run the engine with the scorer and the refiner selected by the parameters.
+*/
+template <typename Model>
+RansacEngineResult fitWithModel(
+	const Model& model, const RANSACParameters& parameters,
+	const double* abcissa, const double* ordinate, size_t noOfPoints, const RansacEngineSettings& settings)
+{
+	if (parameters.getScoring() == RANSACScoring::MSAC) {
+		return fitWithClassificationScorer(model, MsacScorer{}, parameters, abcissa, ordinate, noOfPoints, settings);
+	}
+	if (parameters.getScoring() == RANSACScoring::MLESAC) {
+		// the outliers are spread over the range of the ordinate values, at least over the inlier band
+		double outlierRange = 2.0 * settings.threshold;
+		if (noOfPoints > 0) {
+			auto [minimum, maximum] = std::minmax_element(ordinate, ordinate + noOfPoints);
+			outlierRange = std::max(outlierRange, *maximum - *minimum);
 		}
-		if (confirmedInliners.size() >= parameters.getNumberOfInliersToWellFit()) {
-			vector<size_t> inliners(confirmedInliners.begin(), confirmedInliners.end());
-			Column betterAbcissa = abcissa.getSpecifiedRows(inliners);
-			Column betterOrdinate = ordinate.getSpecifiedRows(inliners);
-			LeastSquaresFitStrategy betterStrategy;
-			LinearModel betterModel = betterStrategy.fitLinearModel(betterAbcissa, betterOrdinate);
-			//betterModel.fitModelByOrdinaryLeastSquares(betterAbcissa, betterOrdinate);
-			double betterFit = betterModel.sumOfSquaredResiduals(betterAbcissa, betterOrdinate);
-			if (betterFit < bestErr) {
-				bestModel = betterModel;
-				bestErr   = betterFit;
+		return fitWithClassificationScorer(model, MlesacScorer{ outlierRange }, parameters, abcissa, ordinate, noOfPoints, settings);
+	}
+	if (parameters.isLocallyOptimized()) {
+		RansacEngine<Model, UniformSampler, InlierCountScorer, LocalOptimizationRefiner> engine{
+			model, UniformSampler{}, InlierCountScorer{}, LocalOptimizationRefiner{ parameters.getLocalOptimizationSteps() } };
+		return engine.fit(abcissa, ordinate, noOfPoints, settings);
+	}
+	RansacEngine<Model, UniformSampler, ResidualSumScorer, LeastSquaresRefiner> engine{ model };
+	return engine.fit(abcissa, ordinate, noOfPoints, settings);
+}
+
+} // namespace
+
+RANSACFitStrategy::RANSACFitStrategy(const RANSACParameters& ransacParameters)
+	: _parameters{ ransacParameters }
+{
+	size_t numberOfThreads = Core::ThreadPool::resolveNumberOfThreads(
+		static_cast<size_t>(std::max(_parameters.getNumberOfThreads(), 0)));
+	if (numberOfThreads > 1) {
+		_pThreadPool = std::make_shared<Core::ThreadPool>(numberOfThreads);
+	}
+}
+
+LinearModel RANSACFitStrategy::fitLinearModel(ColumnView abcissa, ColumnView ordinate) {
+	return fitLinearModelWithReport(abcissa, ordinate).model;
+}
+
+RANSACFitReport RANSACFitStrategy::fitLinearModelWithReport(ColumnView abcissa, ColumnView ordinate) {
+	Core::CancellationToken neverCancelled;
+	return fitLinearModelWithReport(abcissa, ordinate, neverCancelled);
+}
+
+RANSACFitReport RANSACFitStrategy::fitLinearModelWithReport(ColumnView abcissa, ColumnView ordinate, const Core::CancellationToken& cancellationToken) {
+	checkNoOfRows(abcissa, ordinate);
+	RansacEngineSettings settings = makeEngineSettings(cancellationToken);
+	// the engine reads the viewed values in place
+	RansacEngineResult result = fitValues(abcissa.data(), ordinate.data(), abcissa.getNoOfRows(), settings);
+	return makeReport(std::move(result), settings, abcissa.getNoOfRows());
+}
+
+std::vector<RANSACFitReport> RANSACFitStrategy::fitLinearModels(ColumnView abcissa, ColumnView ordinate, size_t maxNumberOfModels) {
+	Core::CancellationToken neverCancelled;
+	return fitLinearModels(abcissa, ordinate, maxNumberOfModels, neverCancelled);
+}
+
+std::vector<RANSACFitReport> RANSACFitStrategy::fitLinearModels(ColumnView abcissa, ColumnView ordinate, size_t maxNumberOfModels, const Core::CancellationToken& cancellationToken) {
+	checkNoOfRows(abcissa, ordinate);
+	// the deadline of the time budget is shared by all the searches
+	RansacEngineSettings settings = makeEngineSettings(cancellationToken);
+	// the claimed data points are compacted away, so the search works on its own copy of the values
+	std::vector<double> abcissaValues(abcissa.begin(), abcissa.end());
+	std::vector<double> ordinateValues(ordinate.begin(), ordinate.end());
+	size_t noOfPoints = abcissaValues.size();
+	// the unclaimed data points are kept at the front of the buffers, together with their indexes in the columns
+	std::vector<size_t> pointIndexes(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		pointIndexes[index] = index;
+	}
+	size_t noOfUnclaimedPoints = noOfPoints;
+
+	std::vector<RANSACFitReport> reports;
+	while (reports.size() < maxNumberOfModels && noOfUnclaimedPoints > 0) {
+		RansacEngineResult result = fitValues(abcissaValues.data(), ordinateValues.data(), noOfUnclaimedPoints, settings);
+		if (!result.modelFound) {
+			break;
+		}
+		InlierMask unclaimedInlierMask = std::move(result.inlierMask);
+		bool interrupted = result.interrupted;
+		RANSACFitReport report = makeReport(std::move(result), settings, noOfUnclaimedPoints);
+
+		// map the consensus set to the columns and compact the remaining points in place
+		report.inlierMask.reset(noOfPoints);
+		size_t noOfRemainingPoints = 0;
+		for (size_t index = 0; index < noOfUnclaimedPoints; index++) {
+			if (unclaimedInlierMask.isInlier(index)) {
+				report.inlierMask.setInlier(pointIndexes[index]);
+				continue;
 			}
+			abcissaValues[noOfRemainingPoints] = abcissaValues[index];
+			ordinateValues[noOfRemainingPoints] = ordinateValues[index];
+			pointIndexes[noOfRemainingPoints] = pointIndexes[index];
+			noOfRemainingPoints++;
 		}
-		iterations++;
+		noOfUnclaimedPoints = noOfRemainingPoints;
+		reports.push_back(std::move(report));
+		if (interrupted) {
+			break;
+		}
+	}
+	return reports;
+}
+
+RansacEngineSettings RANSACFitStrategy::makeEngineSettings(const Core::CancellationToken& cancellationToken) const {
+	RansacEngineSettings settings;
+	if (_parameters.hasTimeBudget()) {
+		settings.deadline = std::chrono::steady_clock::now() + _parameters.getTimeBudget();
 	}
-	return bestModel;
+	settings.pCancellationToken = &cancellationToken;
+	settings.pThreadPool = _pThreadPool.get();
+	settings.maxIterations = static_cast<size_t>(std::max(_parameters.getNumberOfIterations(), 0));
+	settings.threshold = _parameters.getTresholdValueToBeInlier();
+	settings.minimumInliers = static_cast<size_t>(std::max(_parameters.getNumberOfInliersToWellFit(), 0));
+	settings.targetConfidence = _parameters.isPreemptive() ? 0.0 : _parameters.getTargetConfidence();
+	settings.seed = _parameters.hasRandomSeed()
+		? _parameters.getRandomSeed()
+		: (static_cast<uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}();
+	settings.preemptiveBlockSize = _parameters.getPreemptiveBlockSize();
+	settings.preemptiveKeptFraction = _parameters.getPreemptiveKeptFraction();
+	settings.sprtBadModelInlierRatio = _parameters.getSprtBadModelInlierRatio();
+	settings.hypothesisBatchSize = _parameters.getHypothesisBatchSize();
+	return settings;
 }
 
-//namespace columnUtils {
-std::vector<size_t> RANSACFitStrategy::getRandomIndexes(size_t numberOfSelectedPoints, size_t noOfRows) {
-	std::random_device rd;
-	std::default_random_engine generator(rd());
-	std::uniform_int_distribution<size_t> distribution(0, noOfRows - 1);
-	std::set<size_t, std::less<>> selectedIndexes;
-	while (selectedIndexes.size() < numberOfSelectedPoints) {
-		selectedIndexes.insert(distribution(generator));
+RansacEngineResult RANSACFitStrategy::fitValues(const double* abcissa, const double* ordinate, size_t noOfPoints, const RansacEngineSettings& settings) const {
+	size_t sampleSize = static_cast<size_t>(std::max(_parameters.getNumberOfRandomSelectedPoints(), 0));
+	return (sampleSize == TwoPointLineModel::sampleSize)
+		? fitWithModel(TwoPointLineModel{}, _parameters, abcissa, ordinate, noOfPoints, settings)
+		: fitWithModel(SampledLineModel{ sampleSize }, _parameters, abcissa, ordinate, noOfPoints, settings);
+}
+
+RANSACFitReport RANSACFitStrategy::makeReport(RansacEngineResult&& result, const RansacEngineSettings& settings, size_t noOfPoints) const {
+	RANSACFitReport report;
+	report.model = result.model;
+	report.modelFound = result.modelFound;
+	report.inlierMask = std::move(result.inlierMask);
+	report.numberOfInliers = result.numberOfInliers;
+	report.sumOfSquaredResiduals = result.sumOfSquaredResiduals;
+	report.numberOfIterations = result.numberOfIterations;
+	report.randomSeed = settings.seed;
+	report.numberOfRejectedHypotheses = result.numberOfRejectedHypotheses;
+	report.numberOfLocalOptimizations = result.numberOfLocalOptimizations;
+	report.interrupted = result.interrupted;
+	if (settings.targetConfidence > 0.0 && report.modelFound && !report.interrupted) {
+		size_t sampleSize = static_cast<size_t>(std::max(_parameters.getNumberOfRandomSelectedPoints(), 0));
+		size_t required = Fitting::getRequiredNumberOfIterations(
+			settings.targetConfidence,
+			static_cast<double>(result.mostInliers) / static_cast<double>(noOfPoints),
+			sampleSize,
+			std::numeric_limits<size_t>::max());
+		report.confidenceReached = report.numberOfIterations >= required;
 	}
-	std::vector<size_t> orderedSelection(selectedIndexes.begin(), selectedIndexes.end());
-	std::sort(orderedSelection.begin(), orderedSelection.end());
-	return orderedSelection;
+	return report;
+}
+
+size_t RANSACFitStrategy::getRequiredNumberOfIterations(double confidence, double inlierRatio, size_t sampleSize, size_t maxIterations) {
+	return Fitting::getRequiredNumberOfIterations(confidence, inlierRatio, sampleSize, maxIterations);
 }
-//}
 
 } // namespace Fitting
-} // namespace ConsoleAppRansacIINamespace
\ No newline at end of file
+} // namespace ConsoleAppRansacIINamespace
@@ -34,10 +34,16 @@ size_t Table::getCommonNoOfRows() const {
 
 constexpr double defaultValueToFillEmptyRow = 0.0;
 void Table::appendColumn(const Column& column) {
-	Column columnToBeAdded = column;
+	appendColumn(Column{ column, getMemoryResource() });
+}
+
+void Table::appendColumn(Column&& column) {
+	Column columnToBeAdded = (column.getMemoryResource() == getMemoryResource())
+		? std::move(column)
+		: Column{ column, getMemoryResource() };
 	if (_noOfColumns != 0) {
 		size_t noOfCommonRows = getCommonNoOfRows();
-		size_t newColumnNoOfRows = column.getNoOfRows();
+		size_t newColumnNoOfRows = columnToBeAdded.getNoOfRows();
 		if (noOfCommonRows > newColumnNoOfRows) {
 			for (size_t index = newColumnNoOfRows; index < noOfCommonRows; index++) {
 				columnToBeAdded.addRow(defaultValueToFillEmptyRow);
@@ -46,7 +52,6 @@ void Table::appendColumn(const Column& column) {
 		else {
 			if (noOfCommonRows < newColumnNoOfRows) {
 				// enlarge the existing columns in the table by extra zeros
-				size_t noOfColumns = getNoOfColumns();
 				for (Column& columnElementInTable : _tableColumns) {
 					for (size_t index = noOfCommonRows; index < newColumnNoOfRows; index++) {
 						columnElementInTable.addRow(defaultValueToFillEmptyRow);
@@ -55,7 +60,7 @@ void Table::appendColumn(const Column& column) {
 			}
 		}
 	}
-	_tableColumns.push_back(columnToBeAdded);
+	_tableColumns.push_back(std::move(columnToBeAdded));
 	_noOfColumns++;
 }
 
@@ -74,15 +79,11 @@ Column Table::getColumn(size_t columnIndex) const {
 	return _tableColumns.at(columnIndex);
 }
 
-double Table::getCellValue(size_t cellRowIndex, size_t cellColumnIndex) const {
-	//TO DO exceptions, out of range
-	if (cellColumnIndex + 1 > _noOfColumns) {
-		throw ColumnIndexOutOfBounds(cellColumnIndex, _noOfColumns);
-	}
-	else
-	{
-		return _tableColumns[cellColumnIndex].getOneRow(cellRowIndex);
+ColumnView Table::getColumnView(size_t columnIndex) const {
+	if (columnIndex >= _noOfColumns) {
+		throw ColumnIndexOutOfBounds(columnIndex, _noOfColumns);
 	}
+	return _tableColumns[columnIndex].getView();
 }
 
 } // namespace Core
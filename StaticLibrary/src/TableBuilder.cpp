@@ -14,9 +14,12 @@
 #include "TableBuilder.h"
 #include "Table.h"
 
+#include <cerrno>
+#include <cstdlib>
 #include <fstream>
-#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 using Column = ConsoleAppRansacIINamespace::Core::Column;
@@ -24,10 +27,50 @@ using Column = ConsoleAppRansacIINamespace::Core::Column;
 namespace ConsoleAppRansacIINamespace {
 namespace IO {
 
-CsvTableBuilder::CsvTableBuilder(std::string csvFilename, int hdLines) 
-	: _csvFilename{ csvFilename }, _hdLines{ hdLines }
+namespace {
+
+/**
+* @brief Split a line at the delimiters as std::getline does, an empty last token is dropped.
+* @param line The line, the tokens view it.
+* @param delimiter The delimiter of the tokens.
+* @param tokens The tokens of the line, allocated from their memory resource.
+*/
+void tokenizeLine(std::string_view line, char delimiter, std::pmr::vector<std::string_view>& tokens) {
+	size_t tokenBegin = 0;
+	while (tokenBegin < line.size()) {
+		size_t tokenEnd = line.find(delimiter, tokenBegin);
+		if (tokenEnd == std::string_view::npos) {
+			tokenEnd = line.size();
+		}
+		tokens.push_back(line.substr(tokenBegin, tokenEnd - tokenBegin));
+		tokenBegin = tokenEnd + 1;
+	}
+}
+
+/**
+* @brief Parse a token of a line as std::stod does, without copying it into a string.
+* @param token The token, it views a null-terminated line and the delimiter after it stops the parsing.
+* @return The parsed value.
+*/
+double parseValue(std::string_view token) {
+	char* parseEnd = nullptr;
+	errno = 0;
+	double value = std::strtod(token.data(), &parseEnd);
+	if (parseEnd == token.data()) {
+		throw std::invalid_argument("stod");
+	}
+	if (errno == ERANGE) {
+		throw std::out_of_range("stod");
+	}
+	return value;
+}
+
+} // namespace
+
+CsvTableBuilder::CsvTableBuilder(std::string csvFilename, int hdLines, std::pmr::memory_resource* pMemoryResource) 
+	: _csvFilename{ csvFilename }, _hdLines{ hdLines }, _pMemoryResource{ pMemoryResource }
 {
-	_currentTable = std::make_unique<Table>();
+	_currentTable = std::make_unique<Table>("", _pMemoryResource);
 };
 
 
@@ -37,8 +80,8 @@ void CsvTableBuilder::buildTable() {
 	inputFile.open(_csvFilename, std::ios_base::in);
 
 	// read the file line by line
-	std::vector<std::string> allLines;
-	std::string line;
+	std::pmr::vector<std::pmr::string> allLines{ _pMemoryResource };
+	std::pmr::string line{ _pMemoryResource };
 	//std::istream& isHeader = std::getline(inputFile, line);
 	while (std::getline(inputFile, line)) {
 		if (!line.empty() && (line.back() == '\n' || line.back() == '\r')) {
@@ -50,36 +93,32 @@ void CsvTableBuilder::buildTable() {
 	// close the file
 	inputFile.close();
 
-	// tokenize the line
+	// tokenize the line, the tokens view the lines
 	constexpr char delimiter = ',';
-	std::vector<std::vector<std::string>> tokenizedCsv{};
-	for (const std::string& oneLine : allLines) {
-		std::vector<std::string> tokenizedLine;
-		std::stringstream ss(oneLine);
-		std::string token;
-		while (getline(ss, token, delimiter)) {
-			tokenizedLine.push_back(token);
-		}
-		tokenizedCsv.push_back(tokenizedLine);
+	std::pmr::vector<std::pmr::vector<std::string_view>> tokenizedCsv{ _pMemoryResource };
+	tokenizedCsv.reserve(allLines.size());
+	for (const std::pmr::string& oneLine : allLines) {
+		tokenizedCsv.emplace_back();
+		tokenizeLine(oneLine, delimiter, tokenizedCsv.back());
 	}
 
 	// Create a table
-	_currentTable = std::make_unique<Table>((tokenizedCsv.at(0)).at(0));
+	_currentTable = std::make_unique<Table>(std::string{ (tokenizedCsv.at(0)).at(0) }, _pMemoryResource);
 
 	// create columns from the tokenized line
 	for (size_t columnIndex = 0; columnIndex < tokenizedCsv.at(1).size(); ++columnIndex) {
-		std::string columnHeader = tokenizedCsv.at(1).at(columnIndex);
-		std::vector<double> columnValues;
+		std::string_view columnHeader = tokenizedCsv.at(1).at(columnIndex);
+		std::pmr::vector<double> columnValues{ _pMemoryResource };
+		columnValues.reserve(tokenizedCsv.size() - 2);
 		for (size_t rowIndex = 2; rowIndex < tokenizedCsv.size(); ++rowIndex) {
 			if (columnIndex < tokenizedCsv.at(rowIndex).size()) {
-				columnValues.push_back(stod(tokenizedCsv.at(rowIndex).at(columnIndex)));
+				columnValues.push_back(parseValue(tokenizedCsv.at(rowIndex).at(columnIndex)));
 			}
 			else {
 				columnValues.push_back(0.0);
 			}
 		}
-		Column tmpColumn(columnValues, columnHeader);
-		_currentTable->appendColumn(tmpColumn);
+		_currentTable->appendColumn(Column{ std::move(columnValues), columnHeader });
 	}
 }
 
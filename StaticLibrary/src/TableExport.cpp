@@ -30,16 +30,16 @@ void TableExportToCsvBase::generateCsvString() {
 
 	// Columns headers
 	for (size_t columnIndex = 0; columnIndex < _pTable->getNoOfColumns(); columnIndex++) {
-		_csvString += _pTable->getColumn(columnIndex).getHeader() + _delimiter;
+		_csvString += std::string(_pTable->getColumnView(columnIndex).getHeader()) + _delimiter;
 	}
 	_csvString += "\n";
 
-	// Table data
-	size_t currentNumberOfRows = _pTable->getColumn(0).getNoOfRows();
+	// Table data, the appended columns are padded to the common number of rows, so the cells are read unchecked
+	size_t currentNumberOfRows = _pTable->getColumnView(0).getNoOfRows();
 	size_t currentNumberOfColumns = _pTable->getNoOfColumns();
 	for (size_t rowIndex = 0; rowIndex < currentNumberOfRows; rowIndex++) {
 		for (size_t columnIndex = 0; columnIndex < currentNumberOfColumns; columnIndex++) {
-			_csvString += std::to_string(_pTable->getCellValue(rowIndex, columnIndex)) + _delimiter;
+			_csvString += std::to_string(_pTable->getCellValueUnchecked(rowIndex, columnIndex)) + _delimiter;
 		}
 		_csvString += "\n";
 	}
@@ -53,16 +53,46 @@ std::string TableExport::ExportToCsvString(const Table& table, const char delimi
 
 	// Columns headers
 	for (size_t columnIndex = 0; columnIndex < table.getNoOfColumns(); columnIndex++) {
-		csvOutput += table.getColumn(columnIndex).getHeader() + delimiter;
+		csvOutput += std::string(table.getColumnView(columnIndex).getHeader()) + delimiter;
 	}
 	csvOutput += "\n";
 
-	// Table data
-	size_t currentNumberOfRows = table.getColumn(0).getNoOfRows();
+	// Table data, the appended columns are padded to the common number of rows, so the cells are read unchecked
+	size_t currentNumberOfRows = table.getColumnView(0).getNoOfRows();
 	size_t currentNumberOfColumns = table.getNoOfColumns();
 	for (size_t rowIndex = 0; rowIndex < currentNumberOfRows; rowIndex++) {
 		for (size_t columnIndex = 0; columnIndex < currentNumberOfColumns; columnIndex++) {
-			csvOutput += std::to_string(table.getCellValue(rowIndex, columnIndex)) + delimiter;
+			csvOutput += std::to_string(table.getCellValueUnchecked(rowIndex, columnIndex)) + delimiter;
+		}
+		csvOutput += "\n";
+	}
+	return csvOutput;
+}
+
+std::string TableExport::ExportToCsvString(const std::string& tableName, const std::vector<Core::ColumnSelection>& columns, const char delimiter) const {
+
+	// Table name
+	std::string csvOutput = { tableName + std::string("\n") };
+
+	// Columns headers
+	for (const Core::ColumnSelection& column : columns) {
+		csvOutput += std::string(column.getHeader()) + delimiter;
+	}
+	csvOutput += "\n";
+
+	// Table data, each row is read from all the selections
+	size_t currentNumberOfRows = columns.empty() ? 0 : columns[0].getNoOfRows();
+	for (const Core::ColumnSelection& column : columns) {
+		if (column.getNoOfRows() != currentNumberOfRows) {
+			std::string exceptionMessage{ "The selections have different numbers of rows |" };
+			exceptionMessage.append(" Column name: ").append(columns[0].getHeader()).append(" Rows: ").append(std::to_string(currentNumberOfRows));
+			exceptionMessage.append(" Column name: ").append(column.getHeader()).append(" Rows: ").append(std::to_string(column.getNoOfRows()));
+			throw Core::Column::RowIndexOutOfBounds(exceptionMessage);
+		}
+	}
+	for (size_t rowIndex = 0; rowIndex < currentNumberOfRows; rowIndex++) {
+		for (const Core::ColumnSelection& column : columns) {
+			csvOutput += std::to_string(column[rowIndex]) + delimiter;
 		}
 		csvOutput += "\n";
 	}
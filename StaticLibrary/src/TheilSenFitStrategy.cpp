@@ -0,0 +1,484 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "TheilSenFitStrategy.h"
+#include "PhiloxRandomGenerator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Fitting {
+
+namespace {
+
+/**
+* @brief The number of elements sorted by one task before the sorted runs are merged level by level.
+*/
+constexpr size_t sortRunLength = 4096;
+
+/**
+* @brief The slopes left in the interval are enumerated when there are at most this many per data point.
+*/
+constexpr uint64_t enumeratedSlopesPerPoint = 8;
+
+/**
+* @brief The half width of the bracket around the expected sample position, in the standard deviations of the position.
+*/
+constexpr double bracketHalfWidth = 3.0;
+
+/**
+* @brief The seed of the slope samples, the selected slope does not depend on it.
+*/
+constexpr uint64_t samplingSeed = 0x7E11;
+
+/**
+* @brief Run the task for each block, on the worker threads if there are any.
+*/
+void forEachBlock(size_t numberOfBlocks, Core::ThreadPool* pThreadPool, const std::function<void(size_t)>& task) {
+	if (pThreadPool == nullptr || numberOfBlocks <= 1) {
+		for (size_t block = 0; block < numberOfBlocks; block++) {
+			task(block);
+		}
+		return;
+	}
+	std::atomic<size_t> nextBlock{ 0 };
+	pThreadPool->runOnEachThread([&](size_t) {
+		for (size_t block = nextBlock++; block < numberOfBlocks; block = nextBlock++) {
+			task(block);
+		}
+	});
+}
+
+/**
+* @brief Merge two sorted runs and call the visitor with each inversion, a pair of a left and a smaller right value.
+* @return The number of the inversions between the runs.
+*/
+template <typename Visitor>
+uint64_t mergeRuns(const size_t* left, size_t leftLength, const size_t* right, size_t rightLength, size_t* merged, Visitor&& visitor) {
+	uint64_t inversions = 0;
+	size_t leftIndex = 0;
+	size_t rightIndex = 0;
+	while (leftIndex < leftLength && rightIndex < rightLength) {
+		if (right[rightIndex] < left[leftIndex]) {
+			for (size_t inverted = leftIndex; inverted < leftLength; inverted++) {
+				visitor(left[inverted], right[rightIndex]);
+			}
+			inversions += leftLength - leftIndex;
+			*merged++ = right[rightIndex++];
+		}
+		else {
+			*merged++ = left[leftIndex++];
+		}
+	}
+	merged = std::copy(left + leftIndex, left + leftLength, merged);
+	std::copy(right + rightIndex, right + rightLength, merged);
+	return inversions;
+}
+
+/**
+* @brief Sort the values by the bottom-up merge sort and call the visitor with each inversion.
+* @return The number of the inversions.
+*/
+template <typename Visitor>
+uint64_t sortCountingInversions(size_t* values, size_t length, size_t* buffer, Visitor&& visitor) {
+	uint64_t inversions = 0;
+	size_t* source = values;
+	size_t* target = buffer;
+	for (size_t width = 1; width < length; width *= 2) {
+		for (size_t first = 0; first < length; first += 2 * width) {
+			size_t middle = std::min(length, first + width);
+			size_t last = std::min(length, first + 2 * width);
+			inversions += mergeRuns(source + first, middle - first, source + middle, last - middle, target + first, visitor);
+		}
+		std::swap(source, target);
+	}
+	if (source != values) {
+		std::copy(source, source + length, values);
+	}
+	return inversions;
+}
+
+/**
+* @brief Count the inversions of the values, the runs and then the merges of each level are shared by the threads.
+*/
+uint64_t countInversions(std::vector<size_t> values, Core::ThreadPool* pThreadPool) {
+	size_t length = values.size();
+	std::vector<size_t> buffer(length);
+	auto noVisitor = [](size_t, size_t) {};
+	size_t numberOfRuns = (length + sortRunLength - 1) / sortRunLength;
+	std::vector<uint64_t> runInversions(numberOfRuns, 0);
+	forEachBlock(numberOfRuns, pThreadPool, [&](size_t run) {
+		size_t first = run * sortRunLength;
+		size_t runLength = std::min(sortRunLength, length - first);
+		runInversions[run] = sortCountingInversions(values.data() + first, runLength, buffer.data() + first, noVisitor);
+	});
+	uint64_t inversions = 0;
+	for (uint64_t count : runInversions) {
+		inversions += count;
+	}
+	for (size_t width = sortRunLength; width < length; width *= 2) {
+		size_t numberOfMerges = (length + 2 * width - 1) / (2 * width);
+		std::vector<uint64_t> mergeInversions(numberOfMerges, 0);
+		forEachBlock(numberOfMerges, pThreadPool, [&](size_t merge) {
+			size_t first = merge * 2 * width;
+			size_t middle = std::min(length, first + width);
+			size_t last = std::min(length, first + 2 * width);
+			mergeInversions[merge] = mergeRuns(
+				values.data() + first, middle - first, values.data() + middle, last - middle, buffer.data() + first, noVisitor);
+		});
+		for (uint64_t count : mergeInversions) {
+			inversions += count;
+		}
+		std::swap(values, buffer);
+	}
+	return inversions;
+}
+
+/**
+* @brief Sort the indexes by the comparator, the runs and then the merges of each level are shared by the threads.
+*/
+template <typename Less>
+void sortIndexes(std::vector<size_t>& indexes, const Less& less, Core::ThreadPool* pThreadPool) {
+	size_t length = indexes.size();
+	size_t numberOfRuns = (length + sortRunLength - 1) / sortRunLength;
+	forEachBlock(numberOfRuns, pThreadPool, [&](size_t run) {
+		size_t first = run * sortRunLength;
+		std::sort(indexes.begin() + first, indexes.begin() + std::min(length, first + sortRunLength), less);
+	});
+	std::vector<size_t> buffer(length);
+	for (size_t width = sortRunLength; width < length; width *= 2) {
+		size_t numberOfMerges = (length + 2 * width - 1) / (2 * width);
+		forEachBlock(numberOfMerges, pThreadPool, [&](size_t merge) {
+			size_t first = merge * 2 * width;
+			size_t middle = std::min(length, first + width);
+			size_t last = std::min(length, first + 2 * width);
+			std::merge(indexes.begin() + first, indexes.begin() + middle, indexes.begin() + middle, indexes.begin() + last,
+				buffer.begin() + first, less);
+		});
+		std::swap(indexes, buffer);
+	}
+}
+
+/**
+* @brief A bound of the slope interval, just before or just after the slope.
+*/
+struct SlopeBound {
+	double slope;
+	bool after;
+};
+
+/**
+* @brief The counting of the data points with the ranks inserted so far below a rank (a Fenwick tree).
+*/
+class RankCounter {
+  public:
+	explicit RankCounter(size_t noOfRanks) : _tree(noOfRanks + 1, 0) {}
+
+	void insert(size_t rank) {
+		for (size_t position = rank + 1; position < _tree.size(); position += position & (0 - position)) {
+			_tree[position]++;
+		}
+	}
+
+	/**
+	* @brief Get the number of the inserted ranks smaller than the rank.
+	*/
+	size_t countBelow(size_t rank) const {
+		size_t count = 0;
+		for (size_t position = rank; position > 0; position -= position & (0 - position)) {
+			count += _tree[position];
+		}
+		return count;
+	}
+
+	/**
+	* @brief Get the inserted rank with the given number (from 1) of the smaller or equal inserted ranks.
+	*/
+	size_t findRank(size_t number) const {
+		size_t position = 0;
+		size_t step = 1;
+		while (step * 2 < _tree.size()) {
+			step *= 2;
+		}
+		for (; step > 0; step /= 2) {
+			if (position + step < _tree.size() && _tree[position + step] < number) {
+				position += step;
+				number -= _tree[position];
+			}
+		}
+		return position;
+	}
+
+  private:
+	std::vector<size_t> _tree;
+};
+
+/**
+* @class SlopeSelector
+* @brief The selection of the slope of a given rank among the slopes of all the pairs of data points.
+*/
+class SlopeSelector {
+  public:
+	SlopeSelector(const double* abcissa, const double* ordinate, size_t noOfPoints, Core::ThreadPool* pThreadPool)
+		: _abcissa{ abcissa }, _ordinate{ ordinate }, _noOfPoints{ noOfPoints }, _pThreadPool{ pThreadPool } {}
+
+	/**
+	* @brief Get the number of the pairs of data points with different abcissa values.
+	*/
+	uint64_t countSlopes() const {
+		return countCrossings(getOrder(lowestBound()), highestBound());
+	}
+
+	/**
+	* @brief Select the slope of the rank.
+	* @param rank The rank of the slope, from 1 to countSlopes().
+	*/
+	double select(uint64_t rank) const {
+		SlopeBound lower = lowestBound();
+		SlopeBound upper = highestBound();
+		std::vector<size_t> lowerOrder = getOrder(lower);
+		uint64_t below = 0;
+		uint64_t inside = countCrossings(lowerOrder, upper);
+		Core::PhiloxRandomGenerator generator{ samplingSeed, rank };
+		size_t numberOfSamples = std::max<size_t>(_noOfPoints, 64);
+		bool narrowed = true;
+		while (true) {
+			// the slopes computed from the points and the order of the dual lines round differently, so on the tied
+			// or quantized slopes the candidates may fail to narrow the interval and then all its slopes are enumerated
+			if (!narrowed || inside <= enumeratedSlopesPerPoint * _noOfPoints) {
+				std::vector<double> slopes = enumerateSlopes(lowerOrder, upper);
+				auto selected = slopes.begin() + static_cast<std::ptrdiff_t>(rank - below - 1);
+				std::nth_element(slopes.begin(), selected, slopes.end());
+				return *selected;
+			}
+
+			std::vector<double> samples = sampleSlopes(lowerOrder, upper, numberOfSamples, generator);
+			std::sort(samples.begin(), samples.end());
+			double expectedPosition = static_cast<double>(rank - below) / static_cast<double>(inside) * static_cast<double>(numberOfSamples);
+			double halfWidth = bracketHalfWidth * std::sqrt(static_cast<double>(numberOfSamples));
+			size_t lowPosition = static_cast<size_t>(std::max(expectedPosition - halfWidth, 0.0));
+			size_t highPosition = static_cast<size_t>(std::min(expectedPosition + halfWidth, static_cast<double>(numberOfSamples - 1)));
+
+			uint64_t insideBefore = inside;
+			for (double candidate : { samples[lowPosition], samples[highPosition] }) {
+				if (candidate <= lower.slope) {
+					continue;
+				}
+				uint64_t beforeCandidate = below + countCrossings(lowerOrder, SlopeBound{ candidate, false });
+				if (rank <= beforeCandidate) {
+					upper = SlopeBound{ candidate, false };
+					inside = beforeCandidate - below;
+					break;
+				}
+				uint64_t upToCandidate = below + countCrossings(lowerOrder, SlopeBound{ candidate, true });
+				if (rank <= upToCandidate) {
+					return candidate;
+				}
+				lower = SlopeBound{ candidate, true };
+				lowerOrder = getOrder(lower);
+				inside = below + inside - upToCandidate;
+				below = upToCandidate;
+			}
+			narrowed = inside < insideBefore;
+		}
+	}
+
+  private:
+	static SlopeBound lowestBound() { return SlopeBound{ -std::numeric_limits<double>::infinity(), true }; }
+
+	static SlopeBound highestBound() { return SlopeBound{ std::numeric_limits<double>::infinity(), true }; }
+
+	double getSlope(size_t first, size_t second) const {
+		return (_ordinate[first] - _ordinate[second]) / (_abcissa[first] - _abcissa[second]);
+	}
+
+	/**
+	* @brief Get the order of the dual lines v = y - t * x at the bound, the lines crossing at the bound are ordered as just before or after it.
+	*/
+	std::vector<size_t> getOrder(const SlopeBound& bound) const {
+		std::vector<size_t> order(_noOfPoints);
+		for (size_t index = 0; index < _noOfPoints; index++) {
+			order[index] = index;
+		}
+		if (std::isinf(bound.slope)) {
+			// far left the lines are ordered by the increasing abcissa, far right by the decreasing one
+			bool increasing = bound.slope < 0;
+			sortIndexes(order, [this, increasing](size_t first, size_t second) {
+				if (_abcissa[first] != _abcissa[second]) {
+					return (_abcissa[first] < _abcissa[second]) == increasing;
+				}
+				if (_ordinate[first] != _ordinate[second]) {
+					return _ordinate[first] < _ordinate[second];
+				}
+				return first < second;
+			}, _pThreadPool);
+			return order;
+		}
+		std::vector<double> values(_noOfPoints);
+		for (size_t index = 0; index < _noOfPoints; index++) {
+			values[index] = _ordinate[index] - bound.slope * _abcissa[index];
+		}
+		bool after = bound.after;
+		sortIndexes(order, [this, &values, after](size_t first, size_t second) {
+			if (values[first] != values[second]) {
+				return values[first] < values[second];
+			}
+			// just after the crossing the line with the larger abcissa is lower
+			if (_abcissa[first] != _abcissa[second]) {
+				return (_abcissa[first] > _abcissa[second]) == after;
+			}
+			if (_ordinate[first] != _ordinate[second]) {
+				return _ordinate[first] < _ordinate[second];
+			}
+			return first < second;
+		}, _pThreadPool);
+		return order;
+	}
+
+	/**
+	* @brief Get the ranks at the upper bound of the lines in the lower order, the inversions of the ranks are the crossings between the bounds.
+	*/
+	std::vector<size_t> getRanks(const std::vector<size_t>& lowerOrder, const std::vector<size_t>& upperOrder) const {
+		std::vector<size_t> upperRanks(_noOfPoints);
+		for (size_t rank = 0; rank < _noOfPoints; rank++) {
+			upperRanks[upperOrder[rank]] = rank;
+		}
+		std::vector<size_t> ranks(_noOfPoints);
+		for (size_t position = 0; position < _noOfPoints; position++) {
+			ranks[position] = upperRanks[lowerOrder[position]];
+		}
+		return ranks;
+	}
+
+	/**
+	* @brief Count the slopes between the bound of the lower order and the upper bound.
+	*/
+	uint64_t countCrossings(const std::vector<size_t>& lowerOrder, const SlopeBound& upper) const {
+		return countInversions(getRanks(lowerOrder, getOrder(upper)), _pThreadPool);
+	}
+
+	/**
+	* @brief Draw the slopes between the bounds uniformly with replacement.
+	*/
+	std::vector<double> sampleSlopes(
+		const std::vector<size_t>& lowerOrder, const SlopeBound& upper, size_t numberOfSamples, Core::PhiloxRandomGenerator& generator) const
+	{
+		std::vector<size_t> upperOrder = getOrder(upper);
+		std::vector<size_t> ranks = getRanks(lowerOrder, upperOrder);
+		// the crossings of each line with the lines before it in the lower order and after it in the upper order
+		std::vector<uint64_t> crossingsAt(_noOfPoints);
+		uint64_t crossings = 0;
+		RankCounter counter{ _noOfPoints };
+		for (size_t position = 0; position < _noOfPoints; position++) {
+			crossingsAt[position] = position - counter.countBelow(ranks[position]);
+			crossings += crossingsAt[position];
+			counter.insert(ranks[position]);
+		}
+		std::vector<uint64_t> draws(numberOfSamples);
+		for (uint64_t& draw : draws) {
+			draw = generator.uniformIndex(crossings);
+		}
+		std::sort(draws.begin(), draws.end());
+
+		std::vector<double> samples;
+		samples.reserve(numberOfSamples);
+		RankCounter insertedCounter{ _noOfPoints };
+		uint64_t firstCrossing = 0;
+		size_t drawIndex = 0;
+		for (size_t position = 0; position < _noOfPoints && drawIndex < numberOfSamples; position++) {
+			while (drawIndex < numberOfSamples && draws[drawIndex] < firstCrossing + crossingsAt[position]) {
+				// the drawn crossing is with the inserted line of the offset-th rank above the rank of this line
+				size_t offset = static_cast<size_t>(draws[drawIndex] - firstCrossing);
+				size_t crossedRank = insertedCounter.findRank(insertedCounter.countBelow(ranks[position]) + offset + 1);
+				samples.push_back(getSlope(lowerOrder[position], upperOrder[crossedRank]));
+				drawIndex++;
+			}
+			firstCrossing += crossingsAt[position];
+			insertedCounter.insert(ranks[position]);
+		}
+		return samples;
+	}
+
+	/**
+	* @brief Get all the slopes between the bounds.
+	*/
+	std::vector<double> enumerateSlopes(const std::vector<size_t>& lowerOrder, const SlopeBound& upper) const {
+		std::vector<size_t> upperOrder = getOrder(upper);
+		std::vector<size_t> ranks = getRanks(lowerOrder, upperOrder);
+		std::vector<size_t> buffer(_noOfPoints);
+		std::vector<double> slopes;
+		sortCountingInversions(ranks.data(), _noOfPoints, buffer.data(), [&](size_t leftRank, size_t rightRank) {
+			slopes.push_back(getSlope(upperOrder[leftRank], upperOrder[rightRank]));
+		});
+		return slopes;
+	}
+
+	const double* _abcissa;
+	const double* _ordinate;
+	size_t _noOfPoints;
+	Core::ThreadPool* _pThreadPool;
+};
+
+/**
+* @brief Get the median of the values, the mean of the two middle ones for an even count.
+*/
+double getMedian(std::vector<double>& values) {
+	auto middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+	std::nth_element(values.begin(), middle, values.end());
+	if (values.size() % 2 == 1) {
+		return *middle;
+	}
+	return 0.5 * (*std::max_element(values.begin(), middle) + *middle);
+}
+
+} // namespace
+
+TheilSenFitStrategy::TheilSenFitStrategy(int numberOfThreads) {
+	size_t resolvedNumberOfThreads = Core::ThreadPool::resolveNumberOfThreads(static_cast<size_t>(std::max(numberOfThreads, 0)));
+	if (resolvedNumberOfThreads > 1) {
+		_pThreadPool = std::make_shared<Core::ThreadPool>(resolvedNumberOfThreads);
+	}
+}
+
+LinearModel TheilSenFitStrategy::fitLinearModel(ColumnView abcissa, ColumnView ordinate) {
+	checkNoOfRows(abcissa, ordinate);
+	size_t noOfPoints = abcissa.getNoOfRows();
+	const double* abcissaValues = abcissa.data();
+	const double* ordinateValues = ordinate.data();
+	SlopeSelector selector{ abcissaValues, ordinateValues, noOfPoints, _pThreadPool.get() };
+	uint64_t numberOfSlopes = selector.countSlopes();
+	if (numberOfSlopes == 0) {
+		double notANumber = std::numeric_limits<double>::quiet_NaN();
+		return LinearModel{ notANumber, notANumber };
+	}
+	double slope = (numberOfSlopes % 2 == 1)
+		? selector.select((numberOfSlopes + 1) / 2)
+		: 0.5 * (selector.select(numberOfSlopes / 2) + selector.select(numberOfSlopes / 2 + 1));
+
+	std::vector<double> yIntercepts(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		yIntercepts[index] = ordinateValues[index] - slope * abcissaValues[index];
+	}
+	return LinearModel{ getMedian(yIntercepts), slope };
+}
+
+} // namespace Fitting
+} // namespace ConsoleAppRansacIINamespace
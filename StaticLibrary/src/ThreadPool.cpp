@@ -0,0 +1,99 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ThreadPool.h"
+
+#include <chrono>
+
+namespace ConsoleAppRansacIINamespace {
+namespace Core {
+
+// the timed wait on the steady clock is inlined over pthread_cond_clockwait, the untimed one would link against
+// the condition_variable::wait of GLIBCXX_3.4.30 which an older deployed libstdc++ does not have
+constexpr std::chrono::hours idleWorkerWaitLimit{ 1 };
+
+ThreadPool::ThreadPool(size_t numberOfThreads)
+	: _stopping{ false }
+{
+	size_t resolvedNumberOfThreads = resolveNumberOfThreads(numberOfThreads);
+	_workers.reserve(resolvedNumberOfThreads);
+	for (size_t index = 0; index < resolvedNumberOfThreads; index++) {
+		_workers.emplace_back(&ThreadPool::workerLoop, this);
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stopping = true;
+	}
+	_taskAvailable.notify_all();
+	for (std::thread& worker : _workers) {
+		worker.join();
+	}
+}
+
+size_t ThreadPool::resolveNumberOfThreads(size_t requestedNumberOfThreads) {
+	if (requestedNumberOfThreads != 0) {
+		return requestedNumberOfThreads;
+	}
+	size_t hardwareThreads = std::thread::hardware_concurrency();
+	return (hardwareThreads == 0) ? 1 : hardwareThreads;
+}
+
+std::future<void> ThreadPool::submit(std::function<void()> task) {
+	std::packaged_task<void()> packagedTask(std::move(task));
+	std::future<void> result = packagedTask.get_future();
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_tasks.push(std::move(packagedTask));
+	}
+	_taskAvailable.notify_one();
+	return result;
+}
+
+void ThreadPool::runOnEachThread(const std::function<void(size_t)>& task) {
+	std::vector<std::future<void>> pendingRuns;
+	pendingRuns.reserve(_workers.size());
+	for (size_t runIndex = 0; runIndex < _workers.size(); runIndex++) {
+		pendingRuns.push_back(submit([&task, runIndex]() { task(runIndex); }));
+	}
+	// wait for all the runs first, the task is referenced by all of them
+	for (std::future<void>& pendingRun : pendingRuns) {
+		pendingRun.wait();
+	}
+	for (std::future<void>& pendingRun : pendingRuns) {
+		pendingRun.get();
+	}
+}
+
+void ThreadPool::workerLoop() {
+	while (true) {
+		std::packaged_task<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			// an idle worker sleeps until a task is queued or the pool stops, the limit only bounds a single wait
+			while (!_taskAvailable.wait_for(lock, idleWorkerWaitLimit, [this]() { return _stopping || !_tasks.empty(); })) {
+			}
+			if (_tasks.empty()) {
+				return;
+			}
+			task = std::move(_tasks.front());
+			_tasks.pop();
+		}
+		task();
+	}
+}
+
+} // namespace Core
+} // namespace ConsoleAppRansacIINamespace
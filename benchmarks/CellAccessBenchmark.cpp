@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Measures the time of one random cell access: a raw array read, the unchecked and the checked column accessors,
+// the checked table accessor, and the access through one-element vectors as Column::getOneRow did it before
+// the one-branch check. The indexes are drawn up front, so the loops measure the accessors and the memory only.
+
+#include "Column.h"
+#include "Table.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace ConsoleAppRansacIINamespace;
+
+namespace {
+
+/**
+* @brief The number of the accesses per measurement.
+*/
+constexpr size_t accessesPerMeasurement = size_t{ 1 } << 24;
+
+template <typename Function>
+double measureNanosecondsPerAccess(const std::vector<size_t>& rowIndexes, Function&& function) {
+	double sum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t rowIndex : rowIndexes) {
+		sum += function(rowIndex);
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	volatile double sink = sum;
+	(void)sink;
+	return elapsed.count() / static_cast<double>(rowIndexes.size());
+}
+
+/**
+* @brief The access through one-element vectors, as Column::getOneRow did it before the one-branch check.
+*/
+double getOneRowByVectors(const std::vector<double>& values, size_t rowIndex) {
+	std::vector<size_t> selectedIndexes{ rowIndex };
+	std::vector<double> result{};
+	result.push_back(values.at(selectedIndexes.at(0)));
+	return result[0];
+}
+
+} // namespace
+
+int main() {
+	std::mt19937 generator(1);
+	std::cout << "Time per random cell access [ns]" << std::endl;
+	std::cout << std::setw(10) << "rows" << std::setw(12) << "raw" << std::setw(12) << "unchecked"
+		<< std::setw(12) << "checked" << std::setw(12) << "table" << std::setw(12) << "vectors" << std::endl;
+
+	for (size_t noOfRows = size_t{ 1 } << 10; noOfRows <= size_t{ 1 } << 22; noOfRows <<= 4) {
+		std::vector<double> values(noOfRows);
+		for (size_t index = 0; index < noOfRows; index++) {
+			values[index] = static_cast<double>(index);
+		}
+		Core::Column column{ values, "values" };
+		Core::Table table{ "table" };
+		table.appendColumn(column);
+		std::uniform_int_distribution<size_t> rowDistribution(0, noOfRows - 1);
+		std::vector<size_t> rowIndexes(accessesPerMeasurement);
+		for (size_t& rowIndex : rowIndexes) {
+			rowIndex = rowDistribution(generator);
+		}
+
+		std::cout << std::setw(10) << noOfRows << std::fixed << std::setprecision(3);
+		std::cout << std::setw(12) << measureNanosecondsPerAccess(rowIndexes, [&](size_t rowIndex) { return values[rowIndex]; });
+		std::cout << std::setw(12) << measureNanosecondsPerAccess(rowIndexes, [&](size_t rowIndex) { return column.getOneRowUnchecked(rowIndex); });
+		std::cout << std::setw(12) << measureNanosecondsPerAccess(rowIndexes, [&](size_t rowIndex) { return column.getOneRow(rowIndex); });
+		std::cout << std::setw(12) << measureNanosecondsPerAccess(rowIndexes, [&](size_t rowIndex) { return table.getCellValue(rowIndex, 0); });
+		std::cout << std::setw(12) << measureNanosecondsPerAccess(rowIndexes, [&](size_t rowIndex) { return getOneRowByVectors(values, rowIndex); });
+		std::cout << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,170 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Counts the heap allocations and measures the time of building a table from a CSV file with the
+// default memory resource and with a monotonic arena holding the table and the parse scratch.
+// The global operator new is replaced to count the allocations, the arena takes its blocks from it
+// as well, so the counts include the growth of the arena.
+
+#include "Table.h"
+#include "TableBuilder.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <string>
+
+using namespace ConsoleAppRansacIINamespace;
+
+namespace {
+
+std::atomic<size_t> numberOfAllocations{ 0 };
+
+} // namespace
+
+void* operator new(std::size_t size) {
+	numberOfAllocations++;
+	if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+
+// the default memory resource allocates by the aligned operator new,
+// the pointer returned by malloc is stored just before the aligned block
+void* operator new(std::size_t size, std::align_val_t alignment) {
+	numberOfAllocations++;
+	size_t alignmentInBytes = static_cast<size_t>(alignment);
+	void* allocated = std::malloc(size + alignmentInBytes + sizeof(void*));
+	if (allocated == nullptr) {
+		throw std::bad_alloc();
+	}
+	uintptr_t alignedAddress = (reinterpret_cast<uintptr_t>(allocated) + sizeof(void*) + alignmentInBytes - 1) & ~(alignmentInBytes - 1);
+	void* pointer = reinterpret_cast<void*>(alignedAddress);
+	static_cast<void**>(pointer)[-1] = allocated;
+	return pointer;
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+	if (pointer != nullptr) {
+		std::free(static_cast<void**>(pointer)[-1]);
+	}
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept {
+	::operator delete(pointer, alignment);
+}
+
+namespace {
+
+/**
+* @brief The number of the builds of each measurement.
+*/
+constexpr size_t numberOfBuilds = 20;
+
+/**
+* @brief The result of one measurement.
+*/
+struct Measurement {
+	double millisecondsPerBuild;
+	double allocationsPerBuild;
+};
+
+/**
+* @brief Build the table repeatedly, each time from a new memory resource made by the factory.
+*/
+template <typename MakeMemoryResource>
+Measurement measureBuilds(const std::string& csvFilename, MakeMemoryResource&& makeMemoryResource, volatile double& sink) {
+	size_t allocationsBefore = numberOfAllocations.load();
+	auto start = std::chrono::steady_clock::now();
+	for (size_t build = 0; build < numberOfBuilds; build++) {
+		auto pMemoryResource = makeMemoryResource();
+		IO::CsvTableBuilder csvTableBuilder{ csvFilename, 1, pMemoryResource.get() };
+		csvTableBuilder.buildTable();
+		std::unique_ptr<Core::Table> table = csvTableBuilder.getTable();
+		sink = sink + table->getCellValue(0, 0);
+		// the table is destroyed before its memory resource
+	}
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+	return Measurement{
+		elapsed.count() / static_cast<double>(numberOfBuilds),
+		static_cast<double>(numberOfAllocations.load() - allocationsBefore) / static_cast<double>(numberOfBuilds) };
+}
+
+/**
+* @brief The memory resource that forwards to the default resource, so it can be made as the arena is.
+*/
+class DefaultResource : public std::pmr::memory_resource {
+  private:
+	void* do_allocate(size_t bytes, size_t alignment) override {
+		return std::pmr::get_default_resource()->allocate(bytes, alignment);
+	}
+	void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+		std::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+	}
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+		return this == &other;
+	}
+};
+
+} // namespace
+
+int main() {
+	std::string csvFilename = "CsvIngestionBenchmark.csv";
+	constexpr size_t noOfColumns = 4;
+
+	std::cout << "Build of a table from a CSV file" << std::endl;
+	std::cout << std::setw(10) << "rows" << std::setw(16) << "default [ms]" << std::setw(16) << "allocations"
+		<< std::setw(16) << "arena [ms]" << std::setw(16) << "allocations" << std::endl;
+
+	volatile double sink = 0;
+	for (size_t noOfRows = 1000; noOfRows <= 100000; noOfRows *= 10) {
+		std::ofstream csvFile{ csvFilename };
+		csvFile << "Benchmark Table\n";
+		for (size_t columnIndex = 0; columnIndex < noOfColumns; columnIndex++) {
+			csvFile << "Column" << columnIndex << (columnIndex + 1 < noOfColumns ? "," : "\n");
+		}
+		for (size_t rowIndex = 0; rowIndex < noOfRows; rowIndex++) {
+			for (size_t columnIndex = 0; columnIndex < noOfColumns; columnIndex++) {
+				csvFile << 0.001 * static_cast<double>(rowIndex * (columnIndex + 1)) << (columnIndex + 1 < noOfColumns ? "," : "\n");
+			}
+		}
+		csvFile.close();
+
+		Measurement defaultMeasurement = measureBuilds(csvFilename, []() { return std::make_unique<DefaultResource>(); }, sink);
+		Measurement arenaMeasurement = measureBuilds(csvFilename, []() { return std::make_unique<std::pmr::monotonic_buffer_resource>(); }, sink);
+
+		std::cout << std::setw(10) << noOfRows << std::fixed << std::setprecision(3)
+			<< std::setw(16) << defaultMeasurement.millisecondsPerBuild
+			<< std::setw(16) << std::setprecision(0) << defaultMeasurement.allocationsPerBuild
+			<< std::setw(16) << std::setprecision(3) << arenaMeasurement.millisecondsPerBuild
+			<< std::setw(16) << std::setprecision(0) << arenaMeasurement.allocationsPerBuild << std::endl;
+	}
+	std::remove(csvFilename.c_str());
+	return 0;
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the single-pass least squares kernel over the double, float, int32_t and int64_t columns
+// of the same data points, for growing data sizes. The values are converted to double as they are
+// loaded, so past the cache size the float and the int32_t columns are read at half the bandwidth.
+
+#include "Column.h"
+#include "LeastSquaresKernel.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace ConsoleAppRansacIINamespace;
+
+namespace {
+
+/**
+* @brief The number of the data points read per measurement, so the small sizes are repeated enough times.
+*/
+constexpr double pointsPerMeasurement = 2e7;
+
+template <typename Function>
+double measureNanosecondsPerPoint(size_t noOfPoints, Function&& function) {
+	size_t repetitions = static_cast<size_t>(pointsPerMeasurement / static_cast<double>(noOfPoints)) + 1;
+	function();
+	auto start = std::chrono::steady_clock::now();
+	for (size_t repetition = 0; repetition < repetitions; repetition++) {
+		function();
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count() / static_cast<double>(repetitions * noOfPoints);
+}
+
+/**
+* @brief Measure the fit of the columns of the values y = 2x + 1 + (x mod 7) stored as the type T.
+*/
+template <typename T>
+double measureFitOfColumns(size_t noOfPoints, volatile double& sink) {
+	std::vector<T> x(noOfPoints);
+	std::vector<T> y(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		x[index] = static_cast<T>(index % 100000);
+		y[index] = static_cast<T>(2 * (index % 100000) + 1 + index % 7);
+	}
+	Core::BasicColumn<T> xColumn{ x, "x" };
+	Core::BasicColumn<T> yColumn{ y, "y" };
+	return measureNanosecondsPerPoint(noOfPoints, [&]() {
+		sink = sink + Fitting::accumulateLinearSufficientStats(xColumn.getData(), yColumn.getData(), noOfPoints).fit().getSlope();
+	});
+}
+
+} // namespace
+
+int main() {
+	std::cout << "Time per data point [ns]" << std::endl;
+	std::cout << std::setw(10) << "points" << std::setw(16) << "double [KiB]" << std::setw(10) << "double"
+		<< std::setw(10) << "float" << std::setw(10) << "int32" << std::setw(10) << "int64" << std::endl;
+
+	volatile double sink = 0;
+	for (size_t noOfPoints = size_t{ 1 } << 10; noOfPoints <= size_t{ 1 } << 24; noOfPoints <<= 2) {
+		std::cout << std::setw(10) << noOfPoints << std::setw(16) << (2 * noOfPoints * sizeof(double)) / 1024
+			<< std::fixed << std::setprecision(3);
+		std::cout << std::setw(10) << measureFitOfColumns<double>(noOfPoints, sink);
+		std::cout << std::setw(10) << measureFitOfColumns<float>(noOfPoints, sink);
+		std::cout << std::setw(10) << measureFitOfColumns<int32_t>(noOfPoints, sink);
+		std::cout << std::setw(10) << measureFitOfColumns<int64_t>(noOfPoints, sink);
+		std::cout << std::endl;
+	}
+	return 0;
+}
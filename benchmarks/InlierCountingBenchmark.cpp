@@ -0,0 +1,97 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Compares counting the inliers of a batch of lines one line at a time (a full sweep over the data per line)
+// with the tiled batch counting (one sweep per batch) for growing data sizes.
+// While the data points fit in the cache both are compute-bound and perform alike,
+// past the cache size the per-line sweeps become memory-bound and the tiled counting pulls ahead.
+
+#include "CpuFeatures.h"
+#include "InlierCountingKernel.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace ConsoleAppRansacIINamespace;
+
+namespace {
+
+constexpr size_t numberOfLines = 64;
+
+/**
+* @brief The number of the counted residuals per measurement, so the small sizes are repeated enough times.
+*/
+constexpr double residualsPerMeasurement = 2e9;
+
+template <typename Function>
+double measureNanosecondsPerResidual(size_t noOfPoints, Function&& function) {
+	size_t repetitions = static_cast<size_t>(residualsPerMeasurement / static_cast<double>(noOfPoints * numberOfLines)) + 1;
+	function();
+	auto start = std::chrono::steady_clock::now();
+	for (size_t repetition = 0; repetition < repetitions; repetition++) {
+		function();
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count() / static_cast<double>(repetitions * noOfPoints * numberOfLines);
+}
+
+} // namespace
+
+int main() {
+	std::mt19937 generator(1);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> yIntercepts(numberOfLines);
+	std::vector<double> slopes(numberOfLines);
+	for (size_t line = 0; line < numberOfLines; line++) {
+		yIntercepts[line] = 1.0 + noise(generator);
+		slopes[line] = 2.0 + 0.1 * noise(generator);
+	}
+
+	std::cout << "Instruction set: " << Core::getInstructionSetName(Core::getBestSupportedInstructionSet())
+		<< ", " << numberOfLines << " lines per batch" << std::endl;
+	std::cout << std::setw(10) << "points" << std::setw(12) << "data [KiB]"
+		<< std::setw(16) << "per line [ns]" << std::setw(16) << "tiled [ns]" << std::setw(10) << "speedup" << std::endl;
+
+	volatile size_t sink = 0;
+	for (size_t noOfPoints = size_t{ 1 } << 10; noOfPoints <= size_t{ 1 } << 24; noOfPoints <<= 2) {
+		std::vector<double> x(noOfPoints);
+		std::vector<double> y(noOfPoints);
+		for (size_t index = 0; index < noOfPoints; index++) {
+			x[index] = 0.001 * static_cast<double>(index);
+			y[index] = 2.0 * x[index] + 1.0 + noise(generator);
+		}
+		std::vector<uint64_t> inlierMask(Fitting::getInlierMaskWords(noOfPoints));
+		std::vector<size_t> inlierCounts(numberOfLines);
+
+		double perLine = measureNanosecondsPerResidual(noOfPoints, [&]() {
+			for (size_t line = 0; line < numberOfLines; line++) {
+				sink = sink + Fitting::countInliers(x.data(), y.data(), noOfPoints, yIntercepts[line], slopes[line], 1.0, inlierMask.data());
+			}
+		});
+		double tiled = measureNanosecondsPerResidual(noOfPoints, [&]() {
+			Fitting::countInliersInTiles(x.data(), y.data(), noOfPoints, yIntercepts.data(), slopes.data(), numberOfLines, 1.0, inlierCounts.data());
+			sink = sink + inlierCounts[0];
+		});
+
+		std::cout << std::setw(10) << noOfPoints << std::setw(12) << (2 * noOfPoints * sizeof(double)) / 1024
+			<< std::fixed << std::setprecision(3)
+			<< std::setw(16) << perLine << std::setw(16) << tiled
+			<< std::setprecision(2) << std::setw(10) << perLine / tiled << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,111 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Compares the least squares fit through the column accessors (two Column::getAverage passes,
+// then one getOneRow call per row and column) with the single-pass fused kernel of every supported
+// instruction set, for growing data sizes. The fused kernel reads each value once, so past the cache
+// size it runs at the memory bandwidth.
+
+#include "Column.h"
+#include "CpuFeatures.h"
+#include "LeastSquaresKernel.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace ConsoleAppRansacIINamespace;
+
+namespace {
+
+/**
+* @brief The number of the data points read per measurement, so the small sizes are repeated enough times.
+*/
+constexpr double pointsPerMeasurement = 2e7;
+
+template <typename Function>
+double measureNanosecondsPerPoint(size_t noOfPoints, Function&& function) {
+	size_t repetitions = static_cast<size_t>(pointsPerMeasurement / static_cast<double>(noOfPoints)) + 1;
+	function();
+	auto start = std::chrono::steady_clock::now();
+	for (size_t repetition = 0; repetition < repetitions; repetition++) {
+		function();
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count() / static_cast<double>(repetitions * noOfPoints);
+}
+
+/**
+* @brief The fit through the column accessors, as the least squares strategy did it before the fused kernel.
+*/
+double fitSlopeByAccessors(const Core::Column& abcissa, const Core::Column& ordinate) {
+	double abcissaAverage = abcissa.getAverage();
+	double ordinateAverage = ordinate.getAverage();
+	double numerator = 0;
+	double denominator = 0;
+	for (size_t index = 0; index < abcissa.getNoOfRows(); index++) {
+		double abcissaCentralMoment = abcissa.getOneRow(index) - abcissaAverage;
+		double ordinateCentralMoment = ordinate.getOneRow(index) - ordinateAverage;
+		numerator += abcissaCentralMoment * ordinateCentralMoment;
+		denominator += abcissaCentralMoment * abcissaCentralMoment;
+	}
+	return numerator / denominator;
+}
+
+} // namespace
+
+int main() {
+	std::mt19937 generator(1);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<Core::InstructionSet> instructionSets;
+	for (Core::InstructionSet instructionSet : { Core::InstructionSet::Scalar, Core::InstructionSet::SSE2, Core::InstructionSet::AVX2, Core::InstructionSet::AVX512 }) {
+		if (Core::isInstructionSetSupported(instructionSet)) {
+			instructionSets.push_back(instructionSet);
+		}
+	}
+
+	std::cout << "Time per data point [ns]" << std::endl;
+	std::cout << std::setw(10) << "points" << std::setw(12) << "data [KiB]" << std::setw(12) << "accessors";
+	for (Core::InstructionSet instructionSet : instructionSets) {
+		std::cout << std::setw(10) << Core::getInstructionSetName(instructionSet);
+	}
+	std::cout << std::endl;
+
+	volatile double sink = 0;
+	for (size_t noOfPoints = size_t{ 1 } << 10; noOfPoints <= size_t{ 1 } << 24; noOfPoints <<= 2) {
+		std::vector<double> x(noOfPoints);
+		std::vector<double> y(noOfPoints);
+		for (size_t index = 0; index < noOfPoints; index++) {
+			x[index] = 0.001 * static_cast<double>(index);
+			y[index] = 2.0 * x[index] + 1.0 + noise(generator);
+		}
+		Core::Column xColumn{ x, "x" };
+		Core::Column yColumn{ y, "y" };
+
+		std::cout << std::setw(10) << noOfPoints << std::setw(12) << (2 * noOfPoints * sizeof(double)) / 1024
+			<< std::fixed << std::setprecision(3);
+		std::cout << std::setw(12) << measureNanosecondsPerPoint(noOfPoints, [&]() {
+			sink = sink + fitSlopeByAccessors(xColumn, yColumn);
+		});
+		for (Core::InstructionSet instructionSet : instructionSets) {
+			std::cout << std::setw(10) << measureNanosecondsPerPoint(noOfPoints, [&]() {
+				sink = sink + Fitting::accumulateLinearSufficientStats(instructionSet, x.data(), y.data(), noOfPoints).fit().getSlope();
+			});
+		}
+		std::cout << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,156 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Counts the heap allocations and measures the time per data point of evaluating a linear model:
+// the sum of squared residuals built from one-element vectors per data point, as LinearModel did it before
+// the buffer-based API, against evaluate, residuals and sumOfSquaredResiduals over caller-provided buffers.
+// The global operator new is replaced to count the allocations, the exit code is non-zero if any of the
+// buffer-based calls allocates.
+
+#include "Column.h"
+#include "LinearModel.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ConsoleAppRansacIINamespace;
+
+namespace {
+
+std::atomic<size_t> numberOfAllocations{ 0 };
+
+} // namespace
+
+void* operator new(std::size_t size) {
+	numberOfAllocations++;
+	if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+
+namespace {
+
+/**
+* @brief The number of the data points read per measurement.
+*/
+constexpr double pointsPerMeasurement = 2e7;
+
+/**
+* @brief The result of one measurement.
+*/
+struct Measurement {
+	double nanosecondsPerPoint;
+	double allocationsPerCall;
+};
+
+template <typename Function>
+Measurement measure(size_t noOfPoints, Function&& function) {
+	size_t repetitions = static_cast<size_t>(pointsPerMeasurement / static_cast<double>(noOfPoints)) + 1;
+	function();
+	size_t allocationsBefore = numberOfAllocations.load();
+	auto start = std::chrono::steady_clock::now();
+	for (size_t repetition = 0; repetition < repetitions; repetition++) {
+		function();
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	size_t allocations = numberOfAllocations.load() - allocationsBefore;
+	return Measurement{
+		elapsed.count() / static_cast<double>(repetitions * noOfPoints),
+		static_cast<double>(allocations) / static_cast<double>(repetitions) };
+}
+
+/**
+* @brief The sum of squared residuals through one-element vectors per data point, as LinearModel did it before the buffer-based API.
+*/
+double sumOfSquaredResidualsByVectors(const Core::LinearModel& model, const Core::Column& abcissa, const Core::Column& ordinate) {
+	double cummulativeSquare = 0;
+	for (size_t sharedIndex = 0; sharedIndex < abcissa.getNoOfRows(); sharedIndex++) {
+		std::vector<double> modelValueX;
+		modelValueX.push_back(abcissa.getOneRow(sharedIndex));
+		std::vector<double> modelValueY = model.getMultipleValuesAt(modelValueX);
+		double Y = ordinate.getOneRow(sharedIndex);
+		cummulativeSquare += (modelValueY.at(0) - Y) * (modelValueY.at(0) - Y);
+	}
+	return cummulativeSquare;
+}
+
+} // namespace
+
+int main() {
+	std::mt19937 generator(1);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	const Core::LinearModel model{ 1.0, 2.0 };
+	bool buffersAllocate = false;
+
+	std::cout << "Time per data point [ns] (heap allocations per call)" << std::endl;
+	std::cout << std::setw(10) << "points" << std::setw(22) << "vectors per point" << std::setw(22) << "evaluate"
+		<< std::setw(22) << "residuals" << std::setw(22) << "sumOfSquaredResiduals" << std::endl;
+
+	volatile double sink = 0;
+	for (size_t noOfPoints = size_t{ 1 } << 10; noOfPoints <= size_t{ 1 } << 22; noOfPoints <<= 4) {
+		std::vector<double> x(noOfPoints);
+		std::vector<double> y(noOfPoints);
+		for (size_t index = 0; index < noOfPoints; index++) {
+			x[index] = 0.001 * static_cast<double>(index);
+			y[index] = 2.0 * x[index] + 1.0 + noise(generator);
+		}
+		Core::Column xColumn{ x, "x" };
+		Core::Column yColumn{ y, "y" };
+		std::vector<double> buffer(noOfPoints);
+
+		Measurement byVectors = measure(noOfPoints, [&]() {
+			sink = sink + sumOfSquaredResidualsByVectors(model, xColumn, yColumn);
+		});
+		Measurement evaluate = measure(noOfPoints, [&]() {
+			model.evaluate(x.data(), noOfPoints, buffer.data());
+			sink = sink + buffer[noOfPoints / 2];
+		});
+		Measurement residuals = measure(noOfPoints, [&]() {
+			model.residuals(x.data(), y.data(), noOfPoints, buffer.data());
+			sink = sink + buffer[noOfPoints / 2];
+		});
+		Measurement sumOfSquaredResiduals = measure(noOfPoints, [&]() {
+			sink = sink + model.sumOfSquaredResiduals(xColumn, yColumn);
+		});
+
+		std::cout << std::setw(10) << noOfPoints << std::fixed;
+		for (const Measurement& measurement : { byVectors, evaluate, residuals, sumOfSquaredResiduals }) {
+			std::cout << std::setprecision(3) << std::setw(12) << measurement.nanosecondsPerPoint
+				<< " (" << std::setprecision(0) << std::setw(7) << measurement.allocationsPerCall << ")";
+		}
+		std::cout << std::endl;
+		buffersAllocate = buffersAllocate || evaluate.allocationsPerCall != 0 || residuals.allocationsPerCall != 0 || sumOfSquaredResiduals.allocationsPerCall != 0;
+	}
+	if (buffersAllocate) {
+		std::cout << "The buffer-based calls allocated on the heap." << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
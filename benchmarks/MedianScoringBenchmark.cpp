@@ -0,0 +1,117 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Compares the scoring of one hypothesis by counting its inliers with the scoring by the median of its squared
+// residuals, as the least median of squares fit does it: all the squared residuals gathered and the median selected
+// by std::nth_element, and the residuals gathered up to the best median so far, which rules out most hypotheses
+// by the count alone, for every supported instruction set.
+
+#include "CpuFeatures.h"
+#include "InlierCountingKernel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace ConsoleAppRansacIINamespace;
+
+namespace {
+
+/**
+* @brief The number of the data points read per measurement, so the small sizes are repeated enough times.
+*/
+constexpr double pointsPerMeasurement = 2e7;
+
+template <typename Function>
+double measureNanosecondsPerPoint(size_t noOfPoints, Function&& function) {
+	size_t repetitions = static_cast<size_t>(pointsPerMeasurement / static_cast<double>(noOfPoints)) + 1;
+	function();
+	auto start = std::chrono::steady_clock::now();
+	for (size_t repetition = 0; repetition < repetitions; repetition++) {
+		function();
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count() / static_cast<double>(repetitions * noOfPoints);
+}
+
+} // namespace
+
+int main() {
+	std::mt19937 generator(1);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<Core::InstructionSet> instructionSets;
+	for (Core::InstructionSet instructionSet : { Core::InstructionSet::Scalar, Core::InstructionSet::SSE2, Core::InstructionSet::AVX2, Core::InstructionSet::AVX512 }) {
+		if (Core::isInstructionSetSupported(instructionSet)) {
+			instructionSets.push_back(instructionSet);
+		}
+	}
+
+	std::cout << "Time per data point [ns]: inlier count / full median / median bounded by a better one" << std::endl;
+	std::cout << std::setw(10) << "points";
+	for (Core::InstructionSet instructionSet : instructionSets) {
+		std::cout << std::setw(24) << Core::getInstructionSetName(instructionSet);
+	}
+	std::cout << std::endl;
+
+	volatile double sink = 0;
+	for (size_t noOfPoints = size_t{ 1 } << 12; noOfPoints <= size_t{ 1 } << 22; noOfPoints <<= 2) {
+		std::vector<double> x(noOfPoints);
+		std::vector<double> y(noOfPoints);
+		for (size_t index = 0; index < noOfPoints; index++) {
+			x[index] = 0.001 * static_cast<double>(index);
+			y[index] = 2.0 * x[index] + 1.0 + noise(generator);
+		}
+		std::vector<uint64_t> inlierMask(Fitting::getInlierMaskWords(noOfPoints));
+		std::vector<double> squaredResiduals(noOfPoints);
+		size_t medianRank = noOfPoints / 2;
+		// a slightly wrong hypothesis scored against the median of the true line
+		const double yIntercept = 1.2;
+		const double slope = 2.0;
+		double bestMedian = std::numeric_limits<double>::infinity();
+
+		std::cout << std::setw(10) << noOfPoints << std::fixed << std::setprecision(3);
+		for (Core::InstructionSet instructionSet : instructionSets) {
+			double counting = measureNanosecondsPerPoint(noOfPoints, [&]() {
+				sink = sink + static_cast<double>(Fitting::countInliers(
+					instructionSet, x.data(), y.data(), noOfPoints, yIntercept, slope, 1.0, inlierMask.data()));
+			});
+			auto selectMedian = [&](double bound) {
+				size_t numberOfGathered = Fitting::gatherSquaredResiduals(
+					instructionSet, x.data(), y.data(), noOfPoints, yIntercept, slope, bound, squaredResiduals.data());
+				if (numberOfGathered <= medianRank) {
+					return bound;
+				}
+				std::nth_element(squaredResiduals.begin(), squaredResiduals.begin() + medianRank, squaredResiduals.begin() + numberOfGathered);
+				return squaredResiduals[medianRank];
+			};
+			double fullMedian = measureNanosecondsPerPoint(noOfPoints, [&]() {
+				sink = sink + selectMedian(std::numeric_limits<double>::infinity());
+			});
+			bestMedian = Fitting::gatherSquaredResiduals(
+				instructionSet, x.data(), y.data(), noOfPoints, 1.0, slope, std::numeric_limits<double>::infinity(), squaredResiduals.data());
+			std::nth_element(squaredResiduals.begin(), squaredResiduals.begin() + medianRank, squaredResiduals.end());
+			bestMedian = squaredResiduals[medianRank];
+			double boundedMedian = measureNanosecondsPerPoint(noOfPoints, [&]() {
+				sink = sink + selectMedian(bestMedian);
+			});
+			std::cout << std::setw(8) << counting << std::setw(8) << fullMedian << std::setw(8) << boundedMedian;
+		}
+		std::cout << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "CancellationToken.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+using CancellationToken = ConsoleAppRansacIINamespace::Core::CancellationToken;
+
+TEST(CancellationTokenTest, NewTokenIsNotCancelled)
+{
+	// Arrange
+	CancellationToken token;
+
+	// Act
+	bool cancelled = token.isCancelled();
+
+	// Assert
+	EXPECT_FALSE(cancelled);
+}
+
+TEST(CancellationTokenTest, CancelFromOtherThread)
+{
+	// Arrange
+	CancellationToken token;
+
+	// Act
+	std::thread canceller([&token]() { token.cancel(); });
+	canceller.join();
+
+	// Assert
+	EXPECT_TRUE(token.isCancelled());
+}
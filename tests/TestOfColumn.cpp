@@ -18,6 +18,7 @@
 #include <cassert>
 #include <iostream>
 #include <limits>
+#include <type_traits>
 #include <algorithm>
 
 using Column = ConsoleAppRansacIINamespace::Core::Column;
@@ -77,3 +78,78 @@ TEST(ColumnTest, SimpleColumn)
 	std::for_each(input.begin(), input.end(), [&expectedSum](double& item) {expectedSum += item; });
 	EXPECT_EQ(average, expectedSum / expectedNoOfRows);
 }
+
+TEST(ColumnTest, ViewOfColumn)
+{
+	// Arrange
+	std::vector<double> input = { 0, 1, 2 };
+	std::string inputColumnName{ "Column test No. 2" };
+	Column column{ input, inputColumnName };
+
+	// Act
+	ConsoleAppRansacIINamespace::Core::ColumnView view = column.getView();
+	ConsoleAppRansacIINamespace::Core::ColumnView convertedView = column;
+
+	// Assert
+	EXPECT_EQ(input.size(), view.getNoOfRows());
+	EXPECT_EQ(inputColumnName, view.getHeader());
+	EXPECT_EQ(column.getData(), view.data());
+	EXPECT_EQ(view.data(), convertedView.data());
+	std::vector<double> viewedValues(view.begin(), view.end());
+	EXPECT_EQ(input, viewedValues);
+	EXPECT_EQ(input.at(1), view[1]);
+}
+
+TEST(ColumnTest, TemporaryColumnIsNotConvertedToView)
+{
+	// Arrange
+	using ColumnView = ConsoleAppRansacIINamespace::Core::ColumnView;
+
+	// Act & Assert
+	// a view of a temporary column, e.g. the one returned by Table::getColumn, would dangle at the end of the statement
+	EXPECT_TRUE((std::is_convertible<const Column&, ColumnView>::value));
+	EXPECT_TRUE((std::is_convertible<Column&, ColumnView>::value));
+	EXPECT_FALSE((std::is_convertible<Column, ColumnView>::value));
+	EXPECT_FALSE((std::is_convertible<Column&&, ColumnView>::value));
+	EXPECT_FALSE((std::is_convertible<const Column&&, ColumnView>::value));
+}
+
+TEST(ColumnTest, CheckedAndUncheckedRowAccess)
+{
+	// Arrange
+	std::vector<double> input = { 0.5, 1.5, 2.5 };
+	Column column{ input, "Column test No. 3" };
+
+	// Act & Assert
+	for (size_t rowIndex = 0; rowIndex < input.size(); rowIndex++) {
+		EXPECT_EQ(input[rowIndex], column.getOneRow(rowIndex));
+		EXPECT_EQ(input[rowIndex], column.getOneRowUnchecked(rowIndex));
+	}
+	EXPECT_THROW(column.getOneRow(input.size()), Column::RowIndexOutOfBounds);
+	EXPECT_THROW(column.getSpecifiedRows({ 0, input.size() }), Column::RowIndexOutOfBounds);
+}
+
+TEST(ColumnTest, ColumnsOfOtherElementTypes)
+{
+	// Arrange
+	std::vector<float> floatInput = { 0.5f, 1.5f, 4.0f };
+	// the timestamps in nanoseconds, their average does not fit into the 64 bit integers
+	std::vector<int64_t> timestampInput = { 1700000000000000000, 1700000000000000100, 1700000000000000200 };
+
+	// Act
+	ConsoleAppRansacIINamespace::Core::FloatColumn floatColumn{ floatInput, "Float column" };
+	ConsoleAppRansacIINamespace::Core::Int64Column timestampColumn{ timestampInput, "Timestamp column" };
+	timestampColumn.addRow(1700000000000000300);
+	ConsoleAppRansacIINamespace::Core::FloatColumnView floatView = floatColumn;
+
+	// Assert
+	EXPECT_EQ(floatInput, floatColumn.getAllRows());
+	EXPECT_EQ(floatColumn.getData(), floatView.data());
+	EXPECT_EQ(1.5f, floatView[1]);
+	EXPECT_DOUBLE_EQ(2.0, floatColumn.getAverage());
+	EXPECT_EQ(std::vector<float>({ 4.0f, 0.5f }), floatColumn.getSpecifiedRows({ 2, 0 }).getAllRows());
+	EXPECT_EQ(4u, timestampColumn.getNoOfRows());
+	EXPECT_EQ(1700000000000000300, timestampColumn.getOneRow(3));
+	EXPECT_DOUBLE_EQ(1.70000000000000015e18, timestampColumn.getAverage());
+	EXPECT_THROW(timestampColumn.getOneRow(4), ConsoleAppRansacIINamespace::Core::Int64Column::RowIndexOutOfBounds);
+}
@@ -0,0 +1,103 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Column.h"
+#include "ColumnSelection.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using Column = ConsoleAppRansacIINamespace::Core::Column;
+using ColumnSelection = ConsoleAppRansacIINamespace::Core::ColumnSelection;
+using RowSelection = ConsoleAppRansacIINamespace::Core::RowSelection;
+using ConsoleAppRansacIINamespace::Core::gatherRows;
+
+TEST(ColumnSelectionTest, SelectionReadsBaseColumnInPlace)
+{
+	// Arrange
+	std::vector<double> input{ 0.5, 1.5, 2.5, 3.5, 4.5 };
+	Column column{ input, "Base column" };
+	std::vector<size_t> selectedRows{ 4, 1, 3 };
+
+	// Act
+	ColumnSelection selection{ column, std::make_shared<const RowSelection>(selectedRows) };
+
+	// Assert
+	EXPECT_EQ(selectedRows.size(), selection.getNoOfRows());
+	EXPECT_EQ("Base column", selection.getHeader());
+	EXPECT_EQ(column.getData(), selection.getBase().data());
+	EXPECT_EQ(4.5, selection[0]);
+	EXPECT_EQ(1.5, selection[1]);
+	EXPECT_EQ(3.5, selection[2]);
+	EXPECT_EQ(column.getSpecifiedRows(selectedRows).getAllRows(), selection.materialize());
+	EXPECT_EQ(selection.materialize(), selection.materializeColumn("Selected").getAllRows());
+}
+
+TEST(ColumnSelectionTest, RowsSelectedByMask)
+{
+	// Arrange
+	// the rows 1, 64 and 129 of 130, the bits past the last row are ignored
+	std::vector<uint64_t> maskWords{ uint64_t{ 1 } << 1, uint64_t{ 1 }, (uint64_t{ 1 } << 1) | (uint64_t{ 1 } << 5) };
+
+	// Act
+	RowSelection rows{ maskWords.data(), 130 };
+
+	// Assert
+	ASSERT_EQ(3u, rows.size());
+	EXPECT_EQ(1u, rows[0]);
+	EXPECT_EQ(64u, rows[1]);
+	EXPECT_EQ(129u, rows[2]);
+	EXPECT_EQ(130u, rows.getRequiredNoOfRows());
+}
+
+TEST(ColumnSelectionTest, RowOutOfBaseColumn)
+{
+	// Arrange
+	Column column{ std::vector<double>{ 0.0, 1.0 }, "Short column" };
+	auto pRows = std::make_shared<const RowSelection>(std::vector<size_t>{ 0, 2 });
+
+	// Act & Assert
+	EXPECT_THROW((ColumnSelection{ column, pRows }), Column::RowIndexOutOfBounds);
+}
+
+TEST(ColumnSelectionTest, NullRows)
+{
+	// Arrange
+	Column column{ std::vector<double>{ 0.0, 1.0 }, "Short column" };
+	std::shared_ptr<const RowSelection> pRows;
+
+	// Act & Assert
+	EXPECT_THROW((ColumnSelection{ column, pRows }), std::invalid_argument);
+}
+
+TEST(ColumnSelectionTest, GatherLongerThanPrefetchDistance)
+{
+	// Arrange
+	constexpr size_t noOfRows = 1000;
+	std::vector<double> values(noOfRows);
+	std::vector<size_t> rowIndexes;
+	for (size_t index = 0; index < noOfRows; index++) {
+		values[index] = static_cast<double>(index) * 0.25;
+		rowIndexes.push_back((index * 7919) % noOfRows);
+	}
+	std::vector<double> selectedValues(noOfRows);
+
+	// Act
+	gatherRows(values.data(), rowIndexes.data(), noOfRows, selectedValues.data());
+
+	// Assert
+	for (size_t selectedRow = 0; selectedRow < noOfRows; selectedRow++) {
+		EXPECT_EQ(values[rowIndexes[selectedRow]], selectedValues[selectedRow]) << selectedRow;
+	}
+}
@@ -0,0 +1,189 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "InlierCountingKernel.h"
+#include "CpuFeatures.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using InstructionSet = ConsoleAppRansacIINamespace::Core::InstructionSet;
+using ConsoleAppRansacIINamespace::Fitting::countInliers;
+using ConsoleAppRansacIINamespace::Fitting::countInliersInTiles;
+using ConsoleAppRansacIINamespace::Fitting::gatherSquaredResiduals;
+using ConsoleAppRansacIINamespace::Fitting::getInlierMaskWords;
+using ConsoleAppRansacIINamespace::Fitting::inlierCountingTileSize;
+using ConsoleAppRansacIINamespace::Fitting::scoreInliers;
+
+TEST(InlierCountingKernelTest, CountAndMask)
+{
+	// Arrange
+	// y = x, the points 1 and 3 are 0.5 and 2.0 off the line
+	std::vector<double> x{ 0.0, 1.0, 2.0, 3.0, 4.0 };
+	std::vector<double> y{ 0.0, 1.5, 2.0, 5.0, 4.0 };
+	std::vector<uint64_t> inlierMask(getInlierMaskWords(x.size()));
+
+	// Act
+	size_t numberOfInliers = countInliers(x.data(), y.data(), x.size(), 0.0, 1.0, 0.25, inlierMask.data());
+
+	// Assert
+	constexpr size_t expectedNumberOfInliers = 3;
+	constexpr uint64_t expectedMask = 0b10101;
+	EXPECT_EQ(expectedNumberOfInliers, numberOfInliers);
+	EXPECT_EQ(expectedMask, inlierMask[0]);
+}
+
+TEST(InlierCountingKernelTest, AllInstructionSetsAgreeWithScalar)
+{
+	// Arrange
+	// the size is not a multiple of the word size, so the tail is tested as well
+	constexpr size_t noOfPoints = 1000;
+	std::mt19937 generator(7);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x(noOfPoints);
+	std::vector<double> y(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		x[index] = static_cast<double>(index);
+		y[index] = 0.5 * x[index] - 3.0 + noise(generator);
+	}
+	y[10] = std::nan("");
+	constexpr double threshold = 1.0;
+	std::vector<uint64_t> scalarMask(getInlierMaskWords(noOfPoints));
+	size_t scalarInliers = countInliers(InstructionSet::Scalar, x.data(), y.data(), noOfPoints, -3.0, 0.5, threshold, scalarMask.data());
+
+	for (InstructionSet instructionSet : { InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 }) {
+		if (!ConsoleAppRansacIINamespace::Core::isInstructionSetSupported(instructionSet)) {
+			continue;
+		}
+		std::vector<uint64_t> inlierMask(getInlierMaskWords(noOfPoints));
+
+		// Act
+		size_t numberOfInliers = countInliers(instructionSet, x.data(), y.data(), noOfPoints, -3.0, 0.5, threshold, inlierMask.data());
+
+		// Assert
+		std::string name = ConsoleAppRansacIINamespace::Core::getInstructionSetName(instructionSet);
+		EXPECT_EQ(scalarInliers, numberOfInliers) << name;
+		EXPECT_EQ(scalarMask, inlierMask) << name;
+	}
+}
+
+TEST(InlierCountingKernelTest, TiledBatchAgreesWithSingleLines)
+{
+	// Arrange
+	// several tiles and a partial last one
+	constexpr size_t noOfPoints = 2 * inlierCountingTileSize + 77;
+	std::mt19937 generator(3);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x(noOfPoints);
+	std::vector<double> y(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		x[index] = 0.01 * static_cast<double>(index);
+		y[index] = 2.0 * x[index] + 1.0 + noise(generator);
+	}
+	std::vector<double> yIntercepts{ 1.0, 0.0, 1.5, -4.0, 1.0 };
+	std::vector<double> slopes{ 2.0, 2.0, 1.9, 3.0, 2.1 };
+	constexpr double threshold = 1.0;
+
+	// Act
+	std::vector<size_t> inlierCounts(yIntercepts.size());
+	countInliersInTiles(x.data(), y.data(), noOfPoints, yIntercepts.data(), slopes.data(), yIntercepts.size(), threshold, inlierCounts.data());
+
+	// Assert
+	std::vector<uint64_t> inlierMask(getInlierMaskWords(noOfPoints));
+	for (size_t line = 0; line < yIntercepts.size(); line++) {
+		EXPECT_EQ(countInliers(x.data(), y.data(), noOfPoints, yIntercepts[line], slopes[line], threshold, inlierMask.data()), inlierCounts[line]);
+	}
+}
+
+TEST(InlierCountingKernelTest, ScoredInliersAgreeWithCountedInliers)
+{
+	// Arrange
+	constexpr size_t noOfPoints = 1000;
+	std::mt19937 generator(11);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x(noOfPoints);
+	std::vector<double> y(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		x[index] = static_cast<double>(index);
+		y[index] = 0.5 * x[index] - 3.0 + noise(generator);
+	}
+	y[10] = std::nan("");
+	constexpr double threshold = 1.0;
+	std::vector<uint64_t> countedMask(getInlierMaskWords(noOfPoints));
+	size_t countedInliers = countInliers(InstructionSet::Scalar, x.data(), y.data(), noOfPoints, -3.0, 0.5, threshold, countedMask.data());
+	double expectedSquaredResiduals = 0.0;
+	for (size_t index = 0; index < noOfPoints; index++) {
+		double residual = (-3.0 + 0.5 * x[index]) - y[index];
+		if (std::fabs(residual) < threshold) {
+			expectedSquaredResiduals += residual * residual;
+		}
+	}
+
+	for (InstructionSet instructionSet : { InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 }) {
+		if (!ConsoleAppRansacIINamespace::Core::isInstructionSetSupported(instructionSet)) {
+			continue;
+		}
+		std::vector<uint64_t> inlierMask(getInlierMaskWords(noOfPoints));
+		double inlierSquaredResiduals = 0.0;
+
+		// Act
+		size_t numberOfInliers = scoreInliers(
+			instructionSet, x.data(), y.data(), noOfPoints, -3.0, 0.5, threshold, inlierMask.data(), inlierSquaredResiduals);
+
+		// Assert
+		std::string name = ConsoleAppRansacIINamespace::Core::getInstructionSetName(instructionSet);
+		EXPECT_EQ(countedInliers, numberOfInliers) << name;
+		EXPECT_EQ(countedMask, inlierMask) << name;
+		EXPECT_NEAR(expectedSquaredResiduals, inlierSquaredResiduals, 1e-9 * expectedSquaredResiduals) << name;
+	}
+}
+
+TEST(InlierCountingKernelTest, GatheredSquaredResidualsAgreeWithScalar)
+{
+	// Arrange
+	// the size is not a multiple of any vector width, so the tail is tested as well
+	constexpr size_t noOfPoints = 1003;
+	std::mt19937 generator(13);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x(noOfPoints);
+	std::vector<double> y(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		x[index] = static_cast<double>(index);
+		y[index] = 0.5 * x[index] - 3.0 + noise(generator);
+	}
+	y[10] = std::nan("");
+	constexpr double bound = 0.5;
+	std::vector<double> expectedSquaredResiduals;
+	for (size_t index = 0; index < noOfPoints; index++) {
+		double residual = (-3.0 + 0.5 * x[index]) - y[index];
+		if (residual * residual <= bound) {
+			expectedSquaredResiduals.push_back(residual * residual);
+		}
+	}
+
+	for (InstructionSet instructionSet : { InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 }) {
+		if (!ConsoleAppRansacIINamespace::Core::isInstructionSetSupported(instructionSet)) {
+			continue;
+		}
+		std::vector<double> squaredResiduals(noOfPoints);
+
+		// Act
+		size_t numberOfGathered = gatherSquaredResiduals(instructionSet, x.data(), y.data(), noOfPoints, -3.0, 0.5, bound, squaredResiduals.data());
+
+		// Assert
+		std::string name = ConsoleAppRansacIINamespace::Core::getInstructionSetName(instructionSet);
+		squaredResiduals.resize(numberOfGathered);
+		EXPECT_EQ(expectedSquaredResiduals, squaredResiduals) << name;
+	}
+}
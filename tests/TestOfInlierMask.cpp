@@ -0,0 +1,72 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "InlierMask.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using InlierMask = ConsoleAppRansacIINamespace::Fitting::InlierMask;
+
+TEST(InlierMaskTest, EmptyMask)
+{
+	// Arrange
+	constexpr size_t noOfPoints = 100;
+	InlierMask inlierMask{ noOfPoints };
+
+	// Act
+	size_t numberOfInliers = inlierMask.getNumberOfInliers();
+	std::vector<size_t> inlierIndexes = inlierMask.getInlierIndexes();
+
+	// Assert
+	EXPECT_EQ(noOfPoints, inlierMask.getNoOfPoints());
+	EXPECT_EQ(0U, numberOfInliers);
+	EXPECT_TRUE(inlierIndexes.empty());
+}
+
+TEST(InlierMaskTest, SetAndVisitInliers)
+{
+	// Arrange
+	constexpr size_t noOfPoints = 200;
+	InlierMask inlierMask{ noOfPoints };
+	std::vector<size_t> expectedIndexes{ 0, 63, 64, 130, 199 };
+
+	// Act
+	for (size_t index : expectedIndexes) {
+		inlierMask.setInlier(index);
+	}
+	inlierMask.setInlier(5);
+	inlierMask.setInlier(5, false);
+	std::vector<size_t> visitedIndexes;
+	inlierMask.forEachInlier([&visitedIndexes](size_t index) { visitedIndexes.push_back(index); });
+
+	// Assert
+	EXPECT_EQ(expectedIndexes.size(), inlierMask.getNumberOfInliers());
+	EXPECT_EQ(expectedIndexes, visitedIndexes);
+	EXPECT_EQ(expectedIndexes, inlierMask.getInlierIndexes());
+	EXPECT_TRUE(inlierMask.isInlier(63));
+	EXPECT_FALSE(inlierMask.isInlier(5));
+}
+
+TEST(InlierMaskTest, ResetClearsTheMask)
+{
+	// Arrange
+	InlierMask inlierMask{ 10 };
+	inlierMask.setInlier(3);
+
+	// Act
+	inlierMask.reset(70);
+
+	// Assert
+	EXPECT_EQ(70U, inlierMask.getNoOfPoints());
+	EXPECT_EQ(0U, inlierMask.getNumberOfInliers());
+}
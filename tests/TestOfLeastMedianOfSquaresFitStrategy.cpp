@@ -0,0 +1,167 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Column.h"
+#include "LeastMedianOfSquaresFitStrategy.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using Column = ConsoleAppRansacIINamespace::Core::Column;
+using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
+using LeastMedianOfSquaresFitReport = ConsoleAppRansacIINamespace::Fitting::LeastMedianOfSquaresFitReport;
+using LeastMedianOfSquaresFitStrategy = ConsoleAppRansacIINamespace::Fitting::LeastMedianOfSquaresFitStrategy;
+
+namespace {
+
+/**
+* @brief The line y = 0.5 x - 3 with a small noise, every third point moved far above or below it.
+*/
+void makeLineWithOutliers(size_t sizeOfData, std::vector<double>& x, std::vector<double>& y) {
+	std::mt19937 generator(17);
+	std::normal_distribution<double> noise(0.0, 0.1);
+	std::uniform_real_distribution<double> outlierOffset(20.0, 200.0);
+	x.resize(sizeOfData);
+	y.resize(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = static_cast<double>(index) / 10.0;
+		y[index] = 0.5 * x[index] - 3.0 + noise(generator);
+		if (index % 3 == 0) {
+			y[index] += (index % 2 == 0) ? outlierOffset(generator) : -outlierOffset(generator);
+		}
+	}
+}
+
+} // namespace
+
+TEST(LeastMedianOfSquaresFitTest, PureLinearDependency)
+{
+	// Arrange
+	// y = 2x + 1
+	std::vector<double> x(100);
+	std::vector<double> y(100);
+	for (size_t index = 0; index < x.size(); index++) {
+		x[index] = static_cast<double>(index);
+		y[index] = 2.0 * x[index] + 1.0;
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	LeastMedianOfSquaresFitStrategy leastMedianOfSquaresFitStrategy;
+
+	// Act
+	LeastMedianOfSquaresFitReport report = leastMedianOfSquaresFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_DOUBLE_EQ(2.0, report.model.getSlope());
+	EXPECT_DOUBLE_EQ(1.0, report.model.getValueAt0());
+	EXPECT_EQ(0.0, report.medianOfSquaredResiduals);
+	EXPECT_EQ(x.size(), report.numberOfInliers);
+}
+
+TEST(LeastMedianOfSquaresFitTest, OneThirdOfGrossOutliers)
+{
+	// Arrange
+	std::vector<double> x;
+	std::vector<double> y;
+	makeLineWithOutliers(3000, x, y);
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	LeastMedianOfSquaresFitStrategy leastMedianOfSquaresFitStrategy;
+
+	// Act
+	LeastMedianOfSquaresFitReport report = leastMedianOfSquaresFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_NEAR(0.5, report.model.getSlope(), 1e-3);
+	EXPECT_NEAR(-3.0, report.model.getValueAt0(), 1e-1);
+	// the median of all the residuals is the upper quartile of the inlier ones, so the raw scale overestimates the noise
+	EXPECT_GT(report.robustScale, 0.1);
+	EXPECT_LT(report.robustScale, 0.3);
+	for (size_t index = 0; index < x.size(); index += 3) {
+		EXPECT_FALSE(report.inlierMask.isInlier(index)) << index;
+	}
+	EXPECT_GT(report.numberOfInliers, 1900u);
+}
+
+TEST(LeastMedianOfSquaresFitTest, BoundedGatheringSkipsTheMedianOfMostHypotheses)
+{
+	// Arrange
+	std::vector<double> x;
+	std::vector<double> y;
+	makeLineWithOutliers(3000, x, y);
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	LeastMedianOfSquaresFitStrategy leastMedianOfSquaresFitStrategy;
+
+	// Act
+	LeastMedianOfSquaresFitReport report = leastMedianOfSquaresFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_EQ(LeastMedianOfSquaresFitStrategy::defaultNumberOfIterations, report.numberOfIterations);
+	EXPECT_GT(report.numberOfMedianSelections, 0u);
+	EXPECT_LT(report.numberOfMedianSelections, report.numberOfIterations / 10);
+}
+
+TEST(LeastMedianOfSquaresFitTest, FitDoesNotDependOnNumberOfThreads)
+{
+	// Arrange
+	std::vector<double> x;
+	std::vector<double> y;
+	makeLineWithOutliers(3000, x, y);
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	LeastMedianOfSquaresFitStrategy serialFitStrategy{ 500, 1, 42 };
+	LeastMedianOfSquaresFitReport serialReport = serialFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	for (int numberOfThreads : { 2, 3, 4 }) {
+		LeastMedianOfSquaresFitStrategy parallelFitStrategy{ 500, numberOfThreads, 42 };
+
+		// Act
+		LeastMedianOfSquaresFitReport parallelReport = parallelFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+		// Assert
+		EXPECT_EQ(serialReport.medianOfSquaredResiduals, parallelReport.medianOfSquaredResiduals) << numberOfThreads;
+		EXPECT_EQ(serialReport.model.getSlope(), parallelReport.model.getSlope()) << numberOfThreads;
+		EXPECT_EQ(serialReport.model.getValueAt0(), parallelReport.model.getValueAt0()) << numberOfThreads;
+		EXPECT_EQ(serialReport.numberOfInliers, parallelReport.numberOfInliers) << numberOfThreads;
+	}
+}
+
+TEST(LeastMedianOfSquaresFitTest, TooFewPoints)
+{
+	// Arrange
+	Column xColumn{ std::vector<double>{ 1.0 }, "Column X" };
+	Column yColumn{ std::vector<double>{ 2.0 }, "Column Y" };
+	LeastMedianOfSquaresFitStrategy leastMedianOfSquaresFitStrategy;
+
+	// Act
+	LinearModel linearModel = leastMedianOfSquaresFitStrategy.fitLinearModel(xColumn, yColumn);
+
+	// Assert
+	EXPECT_TRUE(std::isnan(linearModel.getSlope()));
+	EXPECT_TRUE(std::isnan(linearModel.getValueAt0()));
+}
+
+TEST(LeastMedianOfSquaresFitTest, ColumnsOfDifferentNoOfRows)
+{
+	// Arrange
+	Column xColumn{ std::vector<double>{ 0.0, 1.0, 2.0, 3.0 }, "Column X" };
+	Column yColumn{ std::vector<double>{ 1.0, 3.0, 5.0 }, "Column Y" };
+	LeastMedianOfSquaresFitStrategy leastMedianOfSquaresFitStrategy;
+
+	// Act & Assert
+	EXPECT_THROW(leastMedianOfSquaresFitStrategy.fitLinearModel(xColumn, yColumn), LeastMedianOfSquaresFitStrategy::DifferentNoOfRows);
+	EXPECT_THROW(leastMedianOfSquaresFitStrategy.fitLinearModelWithReport(xColumn, yColumn), LeastMedianOfSquaresFitStrategy::DifferentNoOfRows);
+}
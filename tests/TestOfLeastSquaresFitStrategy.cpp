@@ -15,6 +15,7 @@
 #include "Common.h"
 #include "Table.h"
 #include "LeastSquaresFitStrategy.h"
+#include "LeastSquaresKernel.h"
 #include <gtest/gtest.h>
 #include <random>
 #include <algorithm>
@@ -279,4 +280,179 @@ TEST(LeastSquaresFitTest, NonLinearModels)
 	EXPECT_TRUE(
 		ConsoleAppRansacIINamespace::Core::doublesAreEqual(expectedSlope, linearModel.getSlope())
 	);
-}
\ No newline at end of file
+}
+TEST(LeastSquaresFitTest, SmallFitDoesNotDependOnInstructionSet)
+{
+	// Arrange
+	// the outlier case of OneOutlier, the lanes of the fused kernel round its y-intercept differently from the two passes
+	std::vector<double> x{ 0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 0.5 };
+	std::vector<double> y{ -1.0, -0.8, -0.6, -0.4, -0.2, 0.0, 0.2, 0.4, 0.6, 0.8, 1.0, 10.0 };
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	LinearModel twoPassModel = ConsoleAppRansacIINamespace::Fitting::accumulateLinearSufficientStatsInTwoPasses(
+		x.data(), y.data(), x.size()).fit();
+
+	// Act
+	LinearModel linearModel = LeastSquaresFitStrategy{}.fitLinearModel(xColumn, yColumn);
+
+	// Assert
+	EXPECT_EQ(twoPassModel.getSlope(), linearModel.getSlope());
+	EXPECT_EQ(twoPassModel.getValueAt0(), linearModel.getValueAt0());
+	EXPECT_EQ(2.0, linearModel.getSlope());
+}
+
+TEST(LeastSquaresFitTest, ChunkedFitDoesNotDependOnNumberOfThreads)
+{
+	// Arrange
+	// several chunks and a partial last one, so the pairwise tree is not balanced
+	constexpr size_t sizeOfData = 5 * LeastSquaresFitStrategy::chunkSize + 123;
+	std::mt19937 generator(9);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 1e-4 * static_cast<double>(index);
+		y[index] = 3.0 * x[index] - 2.0 + noise(generator);
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	LinearModel serialModel = LeastSquaresFitStrategy{ 1 }.fitLinearModel(xColumn, yColumn);
+
+	for (int numberOfThreads : { 2, 3, 4 }) {
+		LeastSquaresFitStrategy leastSquareFitStrategy{ numberOfThreads };
+
+		// Act
+		LinearModel parallelModel = leastSquareFitStrategy.fitLinearModel(xColumn, yColumn);
+
+		// Assert
+		EXPECT_EQ(serialModel.getSlope(), parallelModel.getSlope()) << numberOfThreads;
+		EXPECT_EQ(serialModel.getValueAt0(), parallelModel.getValueAt0()) << numberOfThreads;
+	}
+	EXPECT_NEAR(3.0, serialModel.getSlope(), 0.01);
+	EXPECT_NEAR(-2.0, serialModel.getValueAt0(), 0.02);
+}
+
+TEST(LeastSquaresFitTest, FitOfSelectionEqualsFitOfMaterializedSelection)
+{
+	// Arrange
+	// every third row of several chunks, the selection has several chunks too
+	constexpr size_t sizeOfData = 7 * LeastSquaresFitStrategy::chunkSize + 45;
+	std::mt19937 generator(10);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	std::vector<size_t> selectedRows;
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 1e-4 * static_cast<double>(index);
+		y[index] = 3.0 * x[index] - 2.0 + noise(generator);
+		if (index % 3 == 1) {
+			selectedRows.push_back(index);
+		}
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	auto pRows = std::make_shared<const ConsoleAppRansacIINamespace::Core::RowSelection>(selectedRows);
+	ConsoleAppRansacIINamespace::Core::ColumnSelection xSelection{ xColumn, pRows };
+	ConsoleAppRansacIINamespace::Core::ColumnSelection ySelection{ yColumn, pRows };
+	Column xMaterialized = xColumn.getSpecifiedRows(selectedRows);
+	Column yMaterialized = yColumn.getSpecifiedRows(selectedRows);
+	LinearModel materializedModel = LeastSquaresFitStrategy{ 1 }.fitLinearModel(xMaterialized, yMaterialized);
+
+	for (int numberOfThreads : { 1, 3 }) {
+		LeastSquaresFitStrategy leastSquareFitStrategy{ numberOfThreads };
+
+		// Act
+		LinearModel selectionModel = leastSquareFitStrategy.fitLinearModel(xSelection, ySelection);
+
+		// Assert
+		EXPECT_EQ(materializedModel.getSlope(), selectionModel.getSlope()) << numberOfThreads;
+		EXPECT_EQ(materializedModel.getValueAt0(), selectionModel.getValueAt0()) << numberOfThreads;
+	}
+}
+
+TEST(LeastSquaresFitTest, SelectionsOfDifferentNoOfRows)
+{
+	// Arrange
+	Column xColumn{ std::vector<double>{ 0.0, 1.0, 2.0, 3.0 }, "Column X" };
+	Column yColumn{ std::vector<double>{ 1.0, 3.0, 5.0, 7.0 }, "Column Y" };
+	auto pRows = std::make_shared<const ConsoleAppRansacIINamespace::Core::RowSelection>(std::vector<size_t>{ 0, 1, 3 });
+	auto pFewerRows = std::make_shared<const ConsoleAppRansacIINamespace::Core::RowSelection>(std::vector<size_t>{ 0, 1 });
+	ConsoleAppRansacIINamespace::Core::ColumnSelection xSelection{ xColumn, pRows };
+	ConsoleAppRansacIINamespace::Core::ColumnSelection ySelection{ yColumn, pFewerRows };
+	LeastSquaresFitStrategy leastSquareFitStrategy;
+
+	// Act & Assert
+	EXPECT_THROW(leastSquareFitStrategy.fitLinearModel(xSelection, ySelection), LeastSquaresFitStrategy::DifferentNoOfRows);
+	EXPECT_THROW(leastSquareFitStrategy.accumulate(xSelection, ySelection), LeastSquaresFitStrategy::DifferentNoOfRows);
+}
+
+TEST(LeastSquaresFitTest, FitOfFloatColumnsEqualsFitOfConvertedColumns)
+{
+	// Arrange
+	constexpr size_t sizeOfData = 3 * LeastSquaresFitStrategy::chunkSize + 17;
+	std::mt19937 generator(11);
+	std::normal_distribution<float> noise(0.0f, 1.0f);
+	std::vector<float> x(sizeOfData);
+	std::vector<float> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 1e-4f * static_cast<float>(index);
+		y[index] = 3.0f * x[index] - 2.0f + noise(generator);
+	}
+	ConsoleAppRansacIINamespace::Core::FloatColumn xColumn{ x, "Column X" };
+	ConsoleAppRansacIINamespace::Core::FloatColumn yColumn{ y, "Column Y" };
+	Column xConvertedColumn{ std::vector<double>(x.begin(), x.end()), "Column X" };
+	Column yConvertedColumn{ std::vector<double>(y.begin(), y.end()), "Column Y" };
+	LinearModel convertedModel = LeastSquaresFitStrategy{ 1 }.fitLinearModel(xConvertedColumn, yConvertedColumn);
+
+	for (int numberOfThreads : { 1, 3 }) {
+		LeastSquaresFitStrategy leastSquareFitStrategy{ numberOfThreads };
+
+		// Act
+		LinearModel floatModel = leastSquareFitStrategy.fitLinearModel(xColumn.getView(), yColumn.getView());
+
+		// Assert
+		EXPECT_EQ(convertedModel.getSlope(), floatModel.getSlope()) << numberOfThreads;
+		EXPECT_EQ(convertedModel.getValueAt0(), floatModel.getValueAt0()) << numberOfThreads;
+	}
+	EXPECT_NEAR(3.0, convertedModel.getSlope(), 0.01);
+}
+
+TEST(LeastSquaresFitTest, FitOfInt64TimestampsKeepsDigitsOfTheirDifferences)
+{
+	// the timestamps in nanoseconds 1 ns apart, the small input is accumulated in two passes, the large one by the kernel
+	for (size_t sizeOfData : { size_t{ 1000 }, LeastSquaresFitStrategy::twoPassMaxNoOfPoints, size_t{ 5000 } }) {
+		// Arrange
+		constexpr int64_t firstTimestamp = 1700000000000000001;
+		std::vector<int64_t> x(sizeOfData);
+		std::vector<int64_t> y(sizeOfData);
+		for (size_t index = 0; index < sizeOfData; index++) {
+			x[index] = firstTimestamp + static_cast<int64_t>(index);
+			y[index] = 5 * static_cast<int64_t>(index);
+		}
+		ConsoleAppRansacIINamespace::Core::Int64Column xColumn{ x, "Column X" };
+		ConsoleAppRansacIINamespace::Core::Int64Column yColumn{ y, "Column Y" };
+		LeastSquaresFitStrategy leastSquareFitStrategy;
+
+		// Act
+		LinearModel linearModel = leastSquareFitStrategy.fitLinearModel(xColumn.getView(), yColumn.getView());
+
+		// Assert
+		EXPECT_DOUBLE_EQ(5.0, linearModel.getSlope()) << sizeOfData;
+	}
+}
+
+TEST(LeastSquaresFitTest, ColumnsOfDifferentNoOfRows)
+{
+	// Arrange
+	Column xColumn{ std::vector<double>{ 0.0, 1.0, 2.0, 3.0 }, "Column X" };
+	Column yColumn{ std::vector<double>{ 1.0, 3.0, 5.0 }, "Column Y" };
+	ConsoleAppRansacIINamespace::Core::FloatColumn xFloatColumn{ std::vector<float>{ 0.0f, 1.0f, 2.0f }, "Column X" };
+	ConsoleAppRansacIINamespace::Core::FloatColumn yFloatColumn{ std::vector<float>{ 1.0f, 3.0f }, "Column Y" };
+	LeastSquaresFitStrategy leastSquareFitStrategy;
+
+	// Act & Assert
+	EXPECT_THROW(leastSquareFitStrategy.fitLinearModel(xColumn, yColumn), LeastSquaresFitStrategy::DifferentNoOfRows);
+	EXPECT_THROW(leastSquareFitStrategy.fitLinearModel(xFloatColumn.getView(), yFloatColumn.getView()), LeastSquaresFitStrategy::DifferentNoOfRows);
+	// the strategies and the model throw one exception type for the columns of different numbers of rows
+	EXPECT_THROW(leastSquareFitStrategy.fitLinearModel(xColumn, yColumn), LinearModel::DifferentNoOfRows);
+}
@@ -0,0 +1,219 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "LeastSquaresKernel.h"
+#include "CpuFeatures.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using InstructionSet = ConsoleAppRansacIINamespace::Core::InstructionSet;
+using LinearSufficientStats = ConsoleAppRansacIINamespace::Fitting::LinearSufficientStats;
+using ConsoleAppRansacIINamespace::Fitting::accumulateLinearSufficientStats;
+
+TEST(LeastSquaresKernelTest, AllInstructionSetsAgreeWithWelford)
+{
+	// Arrange
+	// the size is not a multiple of any vector width, so the tail is tested as well
+	constexpr size_t noOfPoints = 1003;
+	std::mt19937 generator(5);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x(noOfPoints);
+	std::vector<double> y(noOfPoints);
+	LinearSufficientStats expectedStats;
+	for (size_t index = 0; index < noOfPoints; index++) {
+		x[index] = 0.1 * static_cast<double>(index) + noise(generator);
+		y[index] = -0.5 * x[index] + 7.0 + noise(generator);
+		expectedStats.add(x[index], y[index]);
+	}
+
+	for (InstructionSet instructionSet : { InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 }) {
+		if (!ConsoleAppRansacIINamespace::Core::isInstructionSetSupported(instructionSet)) {
+			continue;
+		}
+
+		// Act
+		LinearSufficientStats stats = accumulateLinearSufficientStats(instructionSet, x.data(), y.data(), noOfPoints);
+
+		// Assert
+		std::string name = ConsoleAppRansacIINamespace::Core::getInstructionSetName(instructionSet);
+		EXPECT_EQ(noOfPoints, stats.getNoOfPoints()) << name;
+		EXPECT_NEAR(expectedStats.getAbcissaMean(), stats.getAbcissaMean(), 1e-12) << name;
+		EXPECT_NEAR(expectedStats.getOrdinateMean(), stats.getOrdinateMean(), 1e-12) << name;
+		EXPECT_NEAR(expectedStats.getAbcissaComoment(), stats.getAbcissaComoment(), 1e-12 * expectedStats.getAbcissaComoment()) << name;
+		EXPECT_NEAR(expectedStats.getCrossComoment(), stats.getCrossComoment(), 1e-12 * expectedStats.getAbcissaComoment()) << name;
+		EXPECT_NEAR(expectedStats.fit().getSlope(), stats.fit().getSlope(), 1e-12) << name;
+		EXPECT_NEAR(expectedStats.fit().getValueAt0(), stats.fit().getValueAt0(), 1e-10) << name;
+	}
+}
+
+TEST(LeastSquaresKernelTest, AllInstructionSetsGiveBitwiseIdenticalStats)
+{
+	// Arrange
+	// the size is not a multiple of the eight lanes, the values far from the first point make the rounding visible
+	constexpr size_t noOfPoints = 10007;
+	std::mt19937 generator(12);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x(noOfPoints);
+	std::vector<double> y(noOfPoints);
+	std::vector<float> xFloat(noOfPoints);
+	std::vector<float> yFloat(noOfPoints);
+	std::vector<int64_t> xInt64(noOfPoints);
+	std::vector<int64_t> yInt64(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		x[index] = 1e3 * noise(generator);
+		y[index] = 0.3 * x[index] + 1e2 * noise(generator);
+		xFloat[index] = static_cast<float>(x[index]);
+		yFloat[index] = static_cast<float>(y[index]);
+		xInt64[index] = static_cast<int64_t>(1e6 * x[index]);
+		yInt64[index] = static_cast<int64_t>(1e6 * y[index]);
+	}
+	LinearSufficientStats scalarStats = accumulateLinearSufficientStats(InstructionSet::Scalar, x.data(), y.data(), noOfPoints);
+	LinearSufficientStats scalarFloatStats = accumulateLinearSufficientStats(
+		InstructionSet::Scalar, xFloat.data(), yFloat.data(), noOfPoints);
+	LinearSufficientStats scalarInt64Stats = accumulateLinearSufficientStats(
+		InstructionSet::Scalar, xInt64.data(), yInt64.data(), noOfPoints);
+
+	for (InstructionSet instructionSet : { InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 }) {
+		if (!ConsoleAppRansacIINamespace::Core::isInstructionSetSupported(instructionSet)) {
+			continue;
+		}
+
+		// Act
+		LinearSufficientStats stats = accumulateLinearSufficientStats(instructionSet, x.data(), y.data(), noOfPoints);
+		LinearSufficientStats floatStats = accumulateLinearSufficientStats(instructionSet, xFloat.data(), yFloat.data(), noOfPoints);
+		LinearSufficientStats int64Stats = accumulateLinearSufficientStats(instructionSet, xInt64.data(), yInt64.data(), noOfPoints);
+
+		// Assert
+		std::string name = ConsoleAppRansacIINamespace::Core::getInstructionSetName(instructionSet);
+		for (const auto& [expected, actual] : { std::make_pair(scalarStats, stats), std::make_pair(scalarFloatStats, floatStats),
+			std::make_pair(scalarInt64Stats, int64Stats) }) {
+			EXPECT_EQ(expected.getAbcissaMean(), actual.getAbcissaMean()) << name;
+			EXPECT_EQ(expected.getOrdinateMean(), actual.getOrdinateMean()) << name;
+			EXPECT_EQ(expected.getAbcissaComoment(), actual.getAbcissaComoment()) << name;
+			EXPECT_EQ(expected.getCrossComoment(), actual.getCrossComoment()) << name;
+			EXPECT_EQ(expected.getOrdinateComoment(), actual.getOrdinateComoment()) << name;
+		}
+	}
+}
+
+TEST(LeastSquaresKernelTest, LargeOffsetDoesNotCancelTheSlope)
+{
+	// Arrange
+	// y = 2x far from the origin, the noise +, -, -, + is not correlated with the abcissa
+	constexpr size_t noOfPoints = 4000;
+	std::vector<double> x(noOfPoints);
+	std::vector<double> y(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		x[index] = 1e9 + static_cast<double>(index);
+		y[index] = 2.0 * static_cast<double>(index) + ((index % 4 == 0 || index % 4 == 3) ? 0.25 : -0.25);
+	}
+
+	for (InstructionSet instructionSet : { InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 }) {
+		if (!ConsoleAppRansacIINamespace::Core::isInstructionSetSupported(instructionSet)) {
+			continue;
+		}
+
+		// Act
+		LinearSufficientStats stats = accumulateLinearSufficientStats(instructionSet, x.data(), y.data(), noOfPoints);
+
+		// Assert
+		EXPECT_NEAR(2.0, stats.fit().getSlope(), 1e-12) << ConsoleAppRansacIINamespace::Core::getInstructionSetName(instructionSet);
+	}
+}
+
+TEST(LeastSquaresKernelTest, NoPoints)
+{
+	// Act
+	LinearSufficientStats stats = accumulateLinearSufficientStats(nullptr, nullptr, 0);
+
+	// Assert
+	EXPECT_EQ(0U, stats.getNoOfPoints());
+}
+
+TEST(LeastSquaresKernelTest, FloatAndInt32StatsEqualStatsOfConvertedValues)
+{
+	// Arrange
+	constexpr size_t noOfPoints = 1003;
+	std::mt19937 generator(6);
+	std::normal_distribution<float> noise(0.0f, 1.0f);
+	std::vector<float> floatX(noOfPoints);
+	std::vector<float> floatY(noOfPoints);
+	std::vector<int32_t> int32X(noOfPoints);
+	std::vector<int32_t> int32Y(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		floatX[index] = 0.1f * static_cast<float>(index) + noise(generator);
+		floatY[index] = -0.5f * floatX[index] + 7.0f + noise(generator);
+		int32X[index] = static_cast<int32_t>(index * 1000) - 300000;
+		int32Y[index] = 3 * int32X[index] + static_cast<int32_t>(index % 7);
+	}
+	std::vector<double> floatXAsDouble(floatX.begin(), floatX.end());
+	std::vector<double> floatYAsDouble(floatY.begin(), floatY.end());
+	std::vector<double> int32XAsDouble(int32X.begin(), int32X.end());
+	std::vector<double> int32YAsDouble(int32Y.begin(), int32Y.end());
+
+	for (InstructionSet instructionSet : { InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 }) {
+		if (!ConsoleAppRansacIINamespace::Core::isInstructionSetSupported(instructionSet)) {
+			continue;
+		}
+		LinearSufficientStats expectedFloatStats = accumulateLinearSufficientStats(instructionSet, floatXAsDouble.data(), floatYAsDouble.data(), noOfPoints);
+		LinearSufficientStats expectedInt32Stats = accumulateLinearSufficientStats(instructionSet, int32XAsDouble.data(), int32YAsDouble.data(), noOfPoints);
+
+		// Act
+		LinearSufficientStats floatStats = accumulateLinearSufficientStats(instructionSet, floatX.data(), floatY.data(), noOfPoints);
+		LinearSufficientStats int32Stats = accumulateLinearSufficientStats(instructionSet, int32X.data(), int32Y.data(), noOfPoints);
+
+		// Assert
+		// the float and the int32_t values convert to double exactly, so the kernels compute the same sums
+		std::string name = ConsoleAppRansacIINamespace::Core::getInstructionSetName(instructionSet);
+		EXPECT_EQ(expectedFloatStats.getAbcissaMean(), floatStats.getAbcissaMean()) << name;
+		EXPECT_EQ(expectedFloatStats.getCrossComoment(), floatStats.getCrossComoment()) << name;
+		EXPECT_EQ(expectedFloatStats.fit().getSlope(), floatStats.fit().getSlope()) << name;
+		EXPECT_EQ(expectedInt32Stats.getOrdinateMean(), int32Stats.getOrdinateMean()) << name;
+		EXPECT_EQ(expectedInt32Stats.getAbcissaComoment(), int32Stats.getAbcissaComoment()) << name;
+		EXPECT_EQ(expectedInt32Stats.fit().getSlope(), int32Stats.fit().getSlope()) << name;
+	}
+}
+
+TEST(LeastSquaresKernelTest, Int64TimestampsKeepDigitsOfTheirDifferences)
+{
+	// Arrange
+	// the timestamps in nanoseconds 1 ns apart, as doubles they would be rounded to multiples of 256 ns
+	constexpr size_t noOfPoints = 1001;
+	constexpr int64_t firstTimestamp = 1700000000000000001;
+	std::vector<int64_t> x(noOfPoints);
+	std::vector<int64_t> y(noOfPoints);
+	for (size_t index = 0; index < noOfPoints; index++) {
+		x[index] = firstTimestamp + static_cast<int64_t>(index);
+		y[index] = 5 * static_cast<int64_t>(index) + ((index % 4 == 0 || index % 4 == 3) ? 1 : -1);
+	}
+
+	for (InstructionSet instructionSet : { InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 }) {
+		if (!ConsoleAppRansacIINamespace::Core::isInstructionSetSupported(instructionSet)) {
+			continue;
+		}
+
+		// Act
+		LinearSufficientStats stats = accumulateLinearSufficientStats(instructionSet, x.data(), y.data(), noOfPoints);
+
+		// Assert
+		std::string name = ConsoleAppRansacIINamespace::Core::getInstructionSetName(instructionSet);
+		EXPECT_EQ(noOfPoints, stats.getNoOfPoints()) << name;
+		EXPECT_NEAR(5.0, stats.fit().getSlope(), 1e-3) << name;
+	}
+}
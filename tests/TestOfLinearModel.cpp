@@ -0,0 +1,97 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Column.h"
+#include "LinearModel.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using Column = ConsoleAppRansacIINamespace::Core::Column;
+using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
+
+TEST(LinearModelTest, EvaluateAgreesWithValueAt)
+{
+	// Arrange
+	// y = 0.5x - 3, 7 points leave a tail after the partial sums of 4
+	const LinearModel linearModel{ -3.0, 0.5 };
+	std::vector<double> x{ -2.0, 0.0, 1.0, 2.5, 4.0, 10.0, 1e6 };
+	std::vector<double> values(x.size());
+
+	// Act
+	linearModel.evaluate(x.data(), x.size(), values.data());
+
+	// Assert
+	for (size_t index = 0; index < x.size(); index++) {
+		EXPECT_EQ(linearModel.getValueAt(x[index]), values[index]) << index;
+	}
+	EXPECT_EQ(values, linearModel.getMultipleValuesAt(x));
+}
+
+TEST(LinearModelTest, ResidualsAreModelValueMinusOrdinate)
+{
+	// Arrange
+	const LinearModel linearModel{ 1.0, 2.0 };
+	std::vector<double> x{ 0.0, 1.0, 2.0, 3.0, 4.0 };
+	std::vector<double> y{ 1.0, 2.0, 6.0, 7.0, 9.0 };
+	std::vector<double> residuals(x.size());
+
+	// Act
+	linearModel.residuals(x.data(), y.data(), x.size(), residuals.data());
+
+	// Assert
+	std::vector<double> expectedResiduals{ 0.0, 1.0, -1.0, 0.0, 0.0 };
+	EXPECT_EQ(expectedResiduals, residuals);
+}
+
+TEST(LinearModelTest, SumOfSquaredResidualsOfContiguousAndColumnData)
+{
+	// Arrange
+	constexpr size_t noOfPoints = 1003;
+	std::mt19937 generator(5);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x(noOfPoints);
+	std::vector<double> y(noOfPoints);
+	double expectedSumOfSquaredResiduals = 0.0;
+	const LinearModel linearModel{ -3.0, 0.5 };
+	for (size_t index = 0; index < noOfPoints; index++) {
+		x[index] = static_cast<double>(index);
+		y[index] = 0.5 * x[index] - 3.0 + noise(generator);
+		double residual = linearModel.getValueAt(x[index]) - y[index];
+		expectedSumOfSquaredResiduals += residual * residual;
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	// Act
+	double sumOfSquaredResiduals = linearModel.sumOfSquaredResiduals(x.data(), y.data(), noOfPoints);
+	double columnSumOfSquaredResiduals = linearModel.sumOfSquaredResiduals(xColumn, yColumn);
+
+	// Assert
+	EXPECT_NEAR(expectedSumOfSquaredResiduals, sumOfSquaredResiduals, 1e-12 * expectedSumOfSquaredResiduals);
+	EXPECT_EQ(sumOfSquaredResiduals, columnSumOfSquaredResiduals);
+}
+
+TEST(LinearModelTest, SumOfSquaredResidualsOfColumnsOfDifferentNoOfRows)
+{
+	// Arrange
+	const LinearModel linearModel{ 1.0, 2.0 };
+	Column xColumn{ std::vector<double>{ 0.0, 1.0, 2.0 }, "Column X" };
+	Column shorterYColumn{ std::vector<double>{ 1.0, 3.0 }, "Column Y" };
+	Column longerYColumn{ std::vector<double>{ 1.0, 3.0, 5.0, 7.0 }, "Column Y" };
+
+	// Act & Assert
+	EXPECT_THROW(linearModel.sumOfSquaredResiduals(xColumn, shorterYColumn), LinearModel::DifferentNoOfRows);
+	EXPECT_THROW(linearModel.sumOfSquaredResiduals(xColumn, longerYColumn), LinearModel::DifferentNoOfRows);
+}
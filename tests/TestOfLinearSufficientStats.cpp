@@ -0,0 +1,119 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "LinearSufficientStats.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+using LinearSufficientStats = ConsoleAppRansacIINamespace::Fitting::LinearSufficientStats;
+
+TEST(LinearSufficientStatsTest, FitOfAddedPoints)
+{
+	// Arrange
+	// y = 2x + 1 with the residuals +-0.5
+	std::vector<double> x{ 0.0, 1.0, 2.0, 3.0 };
+	std::vector<double> y{ 1.5, 2.5, 5.5, 6.5 };
+	LinearSufficientStats stats;
+
+	// Act
+	for (size_t index = 0; index < x.size(); index++) {
+		stats.add(x[index], y[index]);
+	}
+	LinearModel model = stats.fit();
+
+	// Assert
+	EXPECT_EQ(4U, stats.getNoOfPoints());
+	EXPECT_DOUBLE_EQ(1.5, stats.getAbcissaMean());
+	EXPECT_DOUBLE_EQ(4.0, stats.getOrdinateMean());
+	EXPECT_DOUBLE_EQ(1.8, model.getSlope());
+	EXPECT_DOUBLE_EQ(1.3, model.getValueAt0());
+	double expectedSumOfSquaredResiduals = 0.0;
+	for (size_t index = 0; index < x.size(); index++) {
+		double residual = model.getValueAt(x[index]) - y[index];
+		expectedSumOfSquaredResiduals += residual * residual;
+	}
+	EXPECT_NEAR(expectedSumOfSquaredResiduals, stats.getSumOfSquaredResiduals(), 1e-12);
+}
+
+TEST(LinearSufficientStatsTest, RemoveUndoesAdd)
+{
+	// Arrange
+	LinearSufficientStats stats;
+	LinearSufficientStats expectedStats;
+	for (int index = 0; index < 100; index++) {
+		double x = 0.1 * index;
+		double y = -3.0 * x + 2.0 + std::sin(index);
+		stats.add(x, y);
+		if (index < 60) {
+			expectedStats.add(x, y);
+		}
+	}
+
+	// Act
+	for (int index = 99; index >= 60; index--) {
+		double x = 0.1 * index;
+		stats.remove(x, -3.0 * x + 2.0 + std::sin(index));
+	}
+
+	// Assert
+	EXPECT_EQ(expectedStats.getNoOfPoints(), stats.getNoOfPoints());
+	EXPECT_NEAR(expectedStats.getAbcissaMean(), stats.getAbcissaMean(), 1e-12);
+	EXPECT_NEAR(expectedStats.getOrdinateMean(), stats.getOrdinateMean(), 1e-12);
+	EXPECT_NEAR(expectedStats.fit().getSlope(), stats.fit().getSlope(), 1e-10);
+	EXPECT_NEAR(expectedStats.fit().getValueAt0(), stats.fit().getValueAt0(), 1e-10);
+}
+
+TEST(LinearSufficientStatsTest, MergeOfPartsEqualsAddOfAll)
+{
+	// Arrange
+	LinearSufficientStats allStats;
+	LinearSufficientStats firstPart;
+	LinearSufficientStats secondPart;
+	for (int index = 0; index < 1000; index++) {
+		double x = 0.01 * index;
+		double y = 0.5 * x - 1.0 + std::cos(3.0 * index);
+		allStats.add(x, y);
+		(index < 300 ? firstPart : secondPart).add(x, y);
+	}
+
+	// Act
+	firstPart.merge(secondPart);
+
+	// Assert
+	EXPECT_EQ(allStats.getNoOfPoints(), firstPart.getNoOfPoints());
+	EXPECT_NEAR(allStats.getAbcissaComoment(), firstPart.getAbcissaComoment(), 1e-9);
+	EXPECT_NEAR(allStats.getCrossComoment(), firstPart.getCrossComoment(), 1e-9);
+	EXPECT_NEAR(allStats.getOrdinateComoment(), firstPart.getOrdinateComoment(), 1e-9);
+	EXPECT_NEAR(allStats.fit().getSlope(), firstPart.fit().getSlope(), 1e-12);
+	EXPECT_NEAR(allStats.fit().getValueAt0(), firstPart.fit().getValueAt0(), 1e-12);
+}
+
+TEST(LinearSufficientStatsTest, LargeOffsetDoesNotCancelTheSlope)
+{
+	// Arrange
+	// the raw sums of x * x would lose all the digits of the deviations at this offset
+	constexpr double offset = 1e9;
+	LinearSufficientStats stats;
+
+	// Act
+	for (int index = 0; index < 1000; index++) {
+		double x = offset + index;
+		// the noise +, -, -, + is not correlated with the abcissa, so the slope is exactly 2
+		stats.add(x, 2.0 * index + ((index % 4 == 0 || index % 4 == 3) ? 0.25 : -0.25));
+	}
+
+	// Assert
+	EXPECT_NEAR(2.0, stats.fit().getSlope(), 1e-9);
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MinimalLineSolver.h"
+#include <gtest/gtest.h>
+
+using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
+using MinimalLineSolver = ConsoleAppRansacIINamespace::Fitting::MinimalLineSolver;
+
+TEST(MinimalLineSolverTest, LineThroughTwoPoints)
+{
+	// Arrange
+	LinearModel linearModel;
+	constexpr double expectedSlope{ -2.0 };
+	constexpr double expectedYIntercept{ 2.0 };
+
+	// Act
+	bool solved = MinimalLineSolver::solve(0.0, 2.0, 1.0, 0.0, linearModel);
+
+	// Assert
+	EXPECT_TRUE(solved);
+	EXPECT_EQ(expectedSlope, linearModel.getSlope());
+	EXPECT_EQ(expectedYIntercept, linearModel.getValueAt0());
+}
+
+TEST(MinimalLineSolverTest, IdenticalAbcissasAreDegenerate)
+{
+	// Arrange
+	constexpr double untouchedYIntercept{ 5.0 };
+	constexpr double untouchedSlope{ 7.0 };
+	LinearModel linearModel{ untouchedYIntercept, untouchedSlope };
+
+	// Act
+	bool solved = MinimalLineSolver::solve(1.5, 2.0, 1.5, 3.0, linearModel);
+
+	// Assert
+	EXPECT_FALSE(solved);
+	EXPECT_EQ(untouchedSlope, linearModel.getSlope());
+	EXPECT_EQ(untouchedYIntercept, linearModel.getValueAt0());
+}
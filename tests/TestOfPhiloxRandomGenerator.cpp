@@ -0,0 +1,87 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "PhiloxRandomGenerator.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+using PhiloxRandomGenerator = ConsoleAppRansacIINamespace::Core::PhiloxRandomGenerator;
+
+TEST(PhiloxRandomGeneratorTest, KnownAnswers)
+{
+	// Arrange
+	// the known answers of the Random123 reference implementation
+	std::array<uint32_t, 4> zeroCounter{ 0, 0, 0, 0 };
+	std::array<uint32_t, 2> zeroKey{ 0, 0 };
+	std::array<uint32_t, 4> piCounter{ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 };
+	std::array<uint32_t, 2> piKey{ 0xa4093822, 0x299f31d0 };
+
+	// Act
+	std::array<uint32_t, 4> zeroBlock = PhiloxRandomGenerator::generateBlock(zeroCounter, zeroKey);
+	std::array<uint32_t, 4> piBlock = PhiloxRandomGenerator::generateBlock(piCounter, piKey);
+
+	// Assert
+	std::array<uint32_t, 4> expectedZeroBlock{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 };
+	std::array<uint32_t, 4> expectedPiBlock{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 };
+	EXPECT_EQ(expectedZeroBlock, zeroBlock);
+	EXPECT_EQ(expectedPiBlock, piBlock);
+}
+
+TEST(PhiloxRandomGeneratorTest, StreamsAreReproducible)
+{
+	// Arrange
+	PhiloxRandomGenerator generator{ 42, 7 };
+	PhiloxRandomGenerator sameGenerator{ 42, 7 };
+	PhiloxRandomGenerator otherStream{ 42, 8 };
+
+	// Act
+	std::vector<uint32_t> values;
+	std::vector<uint32_t> sameValues;
+	std::vector<uint32_t> otherValues;
+	for (int index = 0; index < 10; index++) {
+		values.push_back(generator());
+		sameValues.push_back(sameGenerator());
+		otherValues.push_back(otherStream());
+	}
+
+	// Assert
+	EXPECT_EQ(values, sameValues);
+	EXPECT_NE(values, otherValues);
+}
+
+TEST(PhiloxRandomGeneratorTest, SampledIndexesAreDistinct)
+{
+	// Arrange
+	PhiloxRandomGenerator generator{ 1, 0 };
+	std::vector<size_t> hits(10, 0);
+
+	// Act & Assert
+	for (int draw = 0; draw < 1000; draw++) {
+		std::vector<size_t> sample(4);
+		ConsoleAppRansacIINamespace::Core::sampleIndexesWithoutReplacement(generator, hits.size(), sample.size(), sample.data());
+		std::sort(sample.begin(), sample.end());
+		EXPECT_EQ(sample.end(), std::adjacent_find(sample.begin(), sample.end()));
+		EXPECT_LT(sample.back(), hits.size());
+		for (size_t index : sample) {
+			hits[index]++;
+		}
+	}
+	// every index is selected with the probability 0.4
+	for (size_t hit : hits) {
+		EXPECT_GT(hit, 300U);
+		EXPECT_LT(hit, 500U);
+	}
+}
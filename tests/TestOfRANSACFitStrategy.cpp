@@ -16,11 +16,16 @@
 #include "RANSACFitStrategy.h"
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
 
 using Column = ConsoleAppRansacIINamespace::Core::Column;
 using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
 using RANSACFitStrategy = ConsoleAppRansacIINamespace::Fitting::RANSACFitStrategy;
 using RANSACParameters = ConsoleAppRansacIINamespace::Fitting::RANSACParameters;
+using RANSACFitReport = ConsoleAppRansacIINamespace::Fitting::RANSACFitReport;
+using CancellationToken = ConsoleAppRansacIINamespace::Core::CancellationToken;
 
 TEST(RANSACFitTest, TrivialCase)
 {
@@ -94,6 +99,481 @@ TEST(RANSACFitTest, PureLinearCase)
     );
 }
 
+TEST(RANSACFitTest, ParallelPureLinearCase)
+{
+	// Arrange
+	constexpr size_t sizeOfData = 1001;
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	// y = 0.5x + 3
+	constexpr double pureDependencyIntercept = 3.0;
+	constexpr double pureDependencySlope = 0.5;
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 0.01 * static_cast<double>(index);
+		y[index] = pureDependencySlope * x[index] + pureDependencyIntercept;
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters ransacParam(64, 2, 1e-6, 2);
+	ransacParam.setNumberOfThreads(4);
+	RANSACFitStrategy ransacFitStrategy{ ransacParam };
+
+	// Act
+	LinearModel ransac = ransacFitStrategy.fitLinearModel(xColumn, yColumn);
+
+	// Assert
+	EXPECT_NEAR(pureDependencySlope, ransac.getSlope(), 1e-9);
+	EXPECT_NEAR(pureDependencyIntercept, ransac.getValueAt0(), 1e-9);
+}
+
+TEST(RANSACFitTest, RequiredNumberOfIterations)
+{
+	// Arrange
+	constexpr double confidence = 0.99;
+	constexpr size_t sampleSize = 2;
+	constexpr size_t maxIterations = 1000;
+
+	// Act
+	size_t halfInliers = RANSACFitStrategy::getRequiredNumberOfIterations(confidence, 0.5, sampleSize, maxIterations);
+	size_t onlyInliers = RANSACFitStrategy::getRequiredNumberOfIterations(confidence, 1.0, sampleSize, maxIterations);
+	size_t noInliers = RANSACFitStrategy::getRequiredNumberOfIterations(confidence, 0.0, sampleSize, maxIterations);
+
+	// Assert
+	// log(1 - 0.99) / log(1 - 0.5^2) = 16.008
+	constexpr size_t expectedHalfInliers = 17;
+	EXPECT_EQ(expectedHalfInliers, halfInliers);
+	EXPECT_EQ(1U, onlyInliers);
+	EXPECT_EQ(maxIterations, noInliers);
+}
+
+TEST(RANSACFitTest, AdaptiveIterationCount)
+{
+	// Arrange
+	constexpr size_t sizeOfData = 1001;
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	// y = -x + 1
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 0.01 * static_cast<double>(index);
+		y[index] = 1.0 - x[index];
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	// the budget would take minutes, the clean data stop it after the first iteration
+	RANSACParameters ransacParam(100000000, 2, 1e-6, 2);
+	ransacParam.setTargetConfidence(0.99);
+	RANSACFitStrategy ransacFitStrategy{ ransacParam };
+
+	// Act
+	LinearModel ransac = ransacFitStrategy.fitLinearModel(xColumn, yColumn);
+
+	// Assert
+	EXPECT_NEAR(-1.0, ransac.getSlope(), 1e-9);
+	EXPECT_NEAR(1.0, ransac.getValueAt0(), 1e-9);
+}
+
+TEST(RANSACFitTest, DegenerateSamplesAreDrawnAgain)
+{
+	// Arrange
+	// half of the points share the abcissa, a sample of two of them does not determine a line
+	std::vector<double> x{ 1.0, 1.0, 1.0, 1.0, 2.0, 3.0, 4.0, 5.0 };
+	Column xColumn{ x, "Column X" };
+	std::vector<double> y{ 3.0, 3.0, 3.0, 3.0, 5.0, 7.0, 9.0, 11.0 };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters ransacParam(50, 2, 1e-6, 2);
+	RANSACFitStrategy ransacFitStrategy{ ransacParam };
+
+	// Act
+	LinearModel ransac = ransacFitStrategy.fitLinearModel(xColumn, yColumn);
+
+	// Assert
+	// y = 2x + 1
+	EXPECT_NEAR(2.0, ransac.getSlope(), 1e-9);
+	EXPECT_NEAR(1.0, ransac.getValueAt0(), 1e-9);
+}
+
+TEST(RANSACFitTest, ReportLabelsOutliers)
+{
+	// Arrange
+	// y = 3x - 2 with two outliers at the indexes 2 and 6
+	std::vector<double> x{ 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 };
+	Column xColumn{ x, "Column X" };
+	std::vector<double> y{ -2.0, 1.0, 40.0, 7.0, 10.0, 13.0, -30.0, 19.0, 22.0, 25.0 };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters ransacParam(200, 2, 0.5, 5);
+	RANSACFitStrategy ransacFitStrategy{ ransacParam };
+
+	// Act
+	RANSACFitReport report = ransacFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_TRUE(report.modelFound);
+	EXPECT_NEAR(3.0, report.model.getSlope(), 1e-9);
+	EXPECT_NEAR(-2.0, report.model.getValueAt0(), 1e-9);
+	EXPECT_EQ(8U, report.numberOfInliers);
+	EXPECT_EQ(x.size(), report.inlierMask.getNoOfPoints());
+	EXPECT_FALSE(report.inlierMask.isInlier(2));
+	EXPECT_FALSE(report.inlierMask.isInlier(6));
+	EXPECT_TRUE(report.inlierMask.isInlier(0));
+	EXPECT_EQ(200U, report.numberOfIterations);
+}
+
+TEST(RANSACFitTest, SeededFitDoesNotDependOnNumberOfThreads)
+{
+	// Arrange
+	// y = 2x + 1 with a small deterministic noise and every fifth point an outlier
+	constexpr size_t sizeOfData = 500;
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 0.1 * static_cast<double>(index);
+		y[index] = 2.0 * x[index] + 1.0 + 0.05 * std::sin(static_cast<double>(index) * 1.7);
+		if (index % 5 == 0) {
+			y[index] += 25.0;
+		}
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters serialParam(100, 2, 0.06, 10);
+	serialParam.setRandomSeed(20250101);
+	RANSACParameters parallelParam = serialParam;
+	parallelParam.setNumberOfThreads(4);
+	RANSACFitStrategy serialStrategy{ serialParam };
+	RANSACFitStrategy parallelStrategy{ parallelParam };
+
+	// Act
+	RANSACFitReport serialReport = serialStrategy.fitLinearModelWithReport(xColumn, yColumn);
+	RANSACFitReport parallelReport = parallelStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_EQ(20250101U, serialReport.randomSeed);
+	EXPECT_EQ(serialReport.model.getSlope(), parallelReport.model.getSlope());
+	EXPECT_EQ(serialReport.model.getValueAt0(), parallelReport.model.getValueAt0());
+	EXPECT_EQ(serialReport.sumOfSquaredResiduals, parallelReport.sumOfSquaredResiduals);
+	EXPECT_EQ(serialReport.numberOfInliers, parallelReport.numberOfInliers);
+	EXPECT_EQ(serialReport.inlierMask.getInlierIndexes(), parallelReport.inlierMask.getInlierIndexes());
+}
+
+TEST(RANSACFitTest, ReportedSeedReplaysFit)
+{
+	// Arrange
+	std::vector<double> x{ 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 };
+	Column xColumn{ x, "Column X" };
+	std::vector<double> y{ 0.1, 0.9, 2.2, 2.8, 4.1, 5.0, 5.9, 7.2, 30.0, 9.1 };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters ransacParam(5, 2, 0.3, 2);
+	RANSACFitStrategy ransacFitStrategy{ ransacParam };
+	RANSACFitReport report = ransacFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+	ransacParam.setRandomSeed(report.randomSeed);
+	RANSACFitStrategy replayStrategy{ ransacParam };
+
+	// Act
+	RANSACFitReport replay = replayStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_EQ(report.model.getSlope(), replay.model.getSlope());
+	EXPECT_EQ(report.model.getValueAt0(), replay.model.getValueAt0());
+	EXPECT_EQ(report.inlierMask.getInlierIndexes(), replay.inlierMask.getInlierIndexes());
+}
+
+TEST(RANSACFitTest, PreemptiveScoring)
+{
+	// Arrange
+	// y = -x + 4 with a small deterministic noise and 40 % of the points outliers
+	constexpr size_t sizeOfData = 2000;
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 0.01 * static_cast<double>(index);
+		y[index] = -x[index] + 4.0 + 0.01 * std::sin(static_cast<double>(index) * 2.3);
+		if (index % 5 < 2) {
+			y[index] = 100.0 + 50.0 * std::cos(static_cast<double>(index));
+		}
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters ransacParam(128, 2, 0.05, 100);
+	ransacParam.setRandomSeed(7);
+	ransacParam.setPreemptiveScoring(100, 0.5);
+	RANSACFitStrategy ransacFitStrategy{ ransacParam };
+
+	// Act
+	RANSACFitReport report = ransacFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_TRUE(report.modelFound);
+	EXPECT_NEAR(-1.0, report.model.getSlope(), 1e-3);
+	EXPECT_NEAR(4.0, report.model.getValueAt0(), 1e-2);
+	EXPECT_EQ(128U, report.numberOfIterations);
+	EXPECT_EQ(1200U, report.numberOfInliers);
+}
+
+TEST(RANSACFitTest, SprtRejectsBadHypotheses)
+{
+	// Arrange
+	// y = 0.5x + 2 with a small deterministic noise and 70 % of the points outliers
+	constexpr size_t sizeOfData = 5000;
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 0.01 * static_cast<double>(index);
+		y[index] = 0.5 * x[index] + 2.0 + 0.01 * std::sin(static_cast<double>(index) * 0.9);
+		if (index % 10 < 7) {
+			y[index] = 100.0 + 80.0 * std::cos(static_cast<double>(index) * 1.3);
+		}
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters ransacParam(300, 2, 0.05, 1000);
+	ransacParam.setRandomSeed(11);
+	ransacParam.setSprtVerification(0.01);
+	RANSACFitStrategy ransacFitStrategy{ ransacParam };
+
+	// Act
+	RANSACFitReport report = ransacFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_TRUE(report.modelFound);
+	EXPECT_NEAR(0.5, report.model.getSlope(), 1e-3);
+	EXPECT_NEAR(2.0, report.model.getValueAt0(), 1e-2);
+	EXPECT_GE(report.numberOfInliers, 1000U);
+	EXPECT_GT(report.numberOfRejectedHypotheses, 200U);
+}
+
+TEST(RANSACFitTest, LocalOptimizationOfNewBestHypotheses)
+{
+	// Arrange
+	// y = 0.5x + 2 with a small deterministic noise and 70 % of the points outliers
+	constexpr size_t sizeOfData = 5000;
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 0.01 * static_cast<double>(index);
+		y[index] = 0.5 * x[index] + 2.0 + 0.01 * std::sin(static_cast<double>(index) * 0.9);
+		if (index % 10 < 7) {
+			y[index] = 200.0 + 80.0 * std::cos(static_cast<double>(index) * 1.3);
+		}
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters ransacParam(300, 2, 0.05, 100);
+	ransacParam.setRandomSeed(11);
+	ransacParam.setLocalOptimization(5);
+	RANSACFitStrategy ransacFitStrategy{ ransacParam };
+
+	// Act
+	RANSACFitReport report = ransacFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_TRUE(report.modelFound);
+	EXPECT_NEAR(0.5, report.model.getSlope(), 1e-4);
+	EXPECT_NEAR(2.0, report.model.getValueAt0(), 1e-3);
+	EXPECT_EQ(1500U, report.numberOfInliers);
+	EXPECT_EQ(1500U, report.inlierMask.getNumberOfInliers());
+	EXPECT_GE(report.numberOfLocalOptimizations, 1U);
+	EXPECT_LT(report.numberOfLocalOptimizations, 20U);
+}
+
+TEST(RANSACFitTest, CancelledFitReturnsWithoutIterations)
+{
+	// Arrange
+	std::vector<double> x{ 0.0, 1.0, 2.0, 3.0 };
+	Column xColumn{ x, "Column X" };
+	std::vector<double> y{ 1.0, 3.0, 5.0, 7.0 };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters ransacParam(1000, 2, 0.1, 2);
+	RANSACFitStrategy ransacFitStrategy{ ransacParam };
+	CancellationToken cancellationToken;
+	cancellationToken.cancel();
+
+	// Act
+	RANSACFitReport report = ransacFitStrategy.fitLinearModelWithReport(xColumn, yColumn, cancellationToken);
+
+	// Assert
+	EXPECT_TRUE(report.interrupted);
+	EXPECT_FALSE(report.modelFound);
+	EXPECT_EQ(0U, report.numberOfIterations);
+}
+
+TEST(RANSACFitTest, TimeBudgetReturnsBestModelSoFar)
+{
+	// Arrange
+	// y = 2x + 1
+	constexpr size_t sizeOfData = 1000;
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = static_cast<double>(index);
+		y[index] = 2.0 * x[index] + 1.0;
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	// the iterations alone would take hours
+	RANSACParameters ransacParam(std::numeric_limits<int>::max(), 2, 1e-6, 2);
+	ransacParam.setTimeBudget(std::chrono::milliseconds(20));
+	RANSACFitStrategy ransacFitStrategy{ ransacParam };
+
+	// Act
+	RANSACFitReport report = ransacFitStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_TRUE(report.interrupted);
+	EXPECT_TRUE(report.modelFound);
+	EXPECT_FALSE(report.confidenceReached);
+	EXPECT_LT(report.numberOfIterations, static_cast<size_t>(std::numeric_limits<int>::max()));
+	EXPECT_NEAR(2.0, report.model.getSlope(), 1e-9);
+	EXPECT_NEAR(1.0, report.model.getValueAt0(), 1e-9);
+}
+
+TEST(RANSACFitTest, BatchedEvaluationMatchesSingleEvaluation)
+{
+	// Arrange
+	// y = 2x + 1 with a small deterministic noise and every third point an outlier
+	constexpr size_t sizeOfData = 5000;
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 0.01 * static_cast<double>(index);
+		y[index] = 2.0 * x[index] + 1.0 + 0.05 * std::sin(static_cast<double>(index) * 1.7);
+		if (index % 3 == 0) {
+			y[index] += 30.0;
+		}
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters singleParam(150, 2, 0.06, 1000);
+	singleParam.setRandomSeed(5);
+	RANSACParameters batchedParam = singleParam;
+	batchedParam.setBatchedEvaluation(64);
+	RANSACFitStrategy singleStrategy{ singleParam };
+	RANSACFitStrategy batchedStrategy{ batchedParam };
+
+	// Act
+	RANSACFitReport singleReport = singleStrategy.fitLinearModelWithReport(xColumn, yColumn);
+	RANSACFitReport batchedReport = batchedStrategy.fitLinearModelWithReport(xColumn, yColumn);
+
+	// Assert
+	EXPECT_TRUE(batchedReport.modelFound);
+	EXPECT_EQ(150U, batchedReport.numberOfIterations);
+	EXPECT_EQ(singleReport.model.getSlope(), batchedReport.model.getSlope());
+	EXPECT_EQ(singleReport.model.getValueAt0(), batchedReport.model.getValueAt0());
+	EXPECT_EQ(singleReport.numberOfInliers, batchedReport.numberOfInliers);
+}
+
+TEST(RANSACFitTest, TruncatedLossScorings)
+{
+	// Arrange
+	// y = 2x + 1 with a uniform noise of +-0.5 and a quarter of the points scattered far from the line
+	constexpr size_t sizeOfData = 4000;
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 0.01 * static_cast<double>(index);
+		y[index] = 2.0 * x[index] + 1.0 + 0.5 * std::sin(static_cast<double>(index) * 1.7);
+		if (index % 4 == 0) {
+			y[index] += 100.0 + 50.0 * std::cos(static_cast<double>(index));
+		}
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	for (auto scoring : { ConsoleAppRansacIINamespace::Fitting::RANSACScoring::MSAC, ConsoleAppRansacIINamespace::Fitting::RANSACScoring::MLESAC }) {
+		for (int localOptimizationSteps : { 0, 5 }) {
+			RANSACParameters param(1000, 2, 1.0, 100);
+			param.setRandomSeed(17);
+			param.setTargetConfidence(0.99);
+			param.setScoring(scoring);
+			param.setLocalOptimization(localOptimizationSteps);
+			RANSACFitStrategy strategy{ param };
+
+			// Act
+			RANSACFitReport report = strategy.fitLinearModelWithReport(xColumn, yColumn);
+
+			// Assert
+			EXPECT_TRUE(report.modelFound);
+			EXPECT_TRUE(report.confidenceReached);
+			EXPECT_LT(report.numberOfIterations, 1000U);
+			EXPECT_EQ(sizeOfData * 3 / 4, report.numberOfInliers);
+			EXPECT_NEAR(2.0, report.model.getSlope(), 0.01);
+			EXPECT_NEAR(1.0, report.model.getValueAt0(), 0.05);
+		}
+	}
+}
+
+TEST(RANSACFitTest, SequentialFitOfSeveralLines)
+{
+	// Arrange
+	// three segments of the lines y = x, y = 100 - x and y = 3x - 150 over disjoint ranges of the abcissa
+	constexpr size_t firstSize = 1500;
+	constexpr size_t secondSize = 1000;
+	constexpr size_t thirdSize = 700;
+	std::vector<double> x;
+	std::vector<double> y;
+	for (size_t index = 0; index < firstSize; index++) {
+		x.push_back(10.0 * static_cast<double>(index) / firstSize);
+		y.push_back(x.back() + 0.1 * std::sin(static_cast<double>(index)));
+	}
+	for (size_t index = 0; index < secondSize; index++) {
+		x.push_back(20.0 + 10.0 * static_cast<double>(index) / secondSize);
+		y.push_back(100.0 - x.back() + 0.1 * std::sin(static_cast<double>(index)));
+	}
+	for (size_t index = 0; index < thirdSize; index++) {
+		x.push_back(40.0 + 10.0 * static_cast<double>(index) / thirdSize);
+		y.push_back(3.0 * x.back() - 150.0 + 0.1 * std::sin(static_cast<double>(index)));
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+
+	RANSACParameters param(500, 2, 0.5, 500);
+	param.setRandomSeed(3);
+	param.setLocalOptimization(5);
+	RANSACFitStrategy strategy{ param };
+
+	// Act
+	std::vector<RANSACFitReport> reports = strategy.fitLinearModels(xColumn, yColumn, 5);
+
+	// Assert
+	// the remaining points are too few for a fourth line
+	ASSERT_EQ(3U, reports.size());
+	EXPECT_EQ(firstSize, reports[0].numberOfInliers);
+	EXPECT_EQ(secondSize, reports[1].numberOfInliers);
+	EXPECT_EQ(thirdSize, reports[2].numberOfInliers);
+	EXPECT_NEAR(1.0, reports[0].model.getSlope(), 0.01);
+	EXPECT_NEAR(-1.0, reports[1].model.getSlope(), 0.01);
+	EXPECT_NEAR(3.0, reports[2].model.getSlope(), 0.01);
+	for (const RANSACFitReport& report : reports) {
+		ASSERT_EQ(x.size(), report.inlierMask.getNoOfPoints());
+		EXPECT_EQ(report.numberOfInliers, report.inlierMask.getNumberOfInliers());
+	}
+	EXPECT_TRUE(reports[0].inlierMask.isInlier(0));
+	EXPECT_TRUE(reports[1].inlierMask.isInlier(firstSize));
+	EXPECT_TRUE(reports[2].inlierMask.isInlier(firstSize + secondSize));
+}
+
+TEST(RANSACFitTest, ColumnsOfDifferentNoOfRows)
+{
+	// Arrange
+	Column xColumn{ std::vector<double>{ 0.0, 1.0, 2.0, 3.0 }, "Column X" };
+	Column yColumn{ std::vector<double>{ 1.0, 3.0, 5.0 }, "Column Y" };
+	RANSACFitStrategy ransacFitStrategy;
+
+	// Act & Assert
+	EXPECT_THROW(ransacFitStrategy.fitLinearModel(xColumn, yColumn), RANSACFitStrategy::DifferentNoOfRows);
+	EXPECT_THROW(ransacFitStrategy.fitLinearModels(xColumn, yColumn, 2), std::out_of_range);
+}
+
 // High Inlier Proportion :
 // If the data contains very few outliers, RANSAC may perform unnecessarily 
 // because it is computationally expensive and may not provide better results than Least Squares.
@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "RansacEngine.h"
+#include "RansacPolicies.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
+using PhiloxRandomGenerator = ConsoleAppRansacIINamespace::Core::PhiloxRandomGenerator;
+using RansacEngineSettings = ConsoleAppRansacIINamespace::Fitting::RansacEngineSettings;
+using RansacEngineResult = ConsoleAppRansacIINamespace::Fitting::RansacEngineResult;
+using TwoPointLineModel = ConsoleAppRansacIINamespace::Fitting::TwoPointLineModel;
+using UniformSampler = ConsoleAppRansacIINamespace::Fitting::UniformSampler;
+using ResidualSumScorer = ConsoleAppRansacIINamespace::Fitting::ResidualSumScorer;
+using LeastSquaresRefiner = ConsoleAppRansacIINamespace::Fitting::LeastSquaresRefiner;
+template <typename Model, typename Sampler, typename Scorer, typename Refiner>
+using RansacEngine = ConsoleAppRansacIINamespace::Fitting::RansacEngine<Model, Sampler, Scorer, Refiner>;
+
+namespace {
+
+/**
+* @brief A sampler always selecting the first data points, it shows a custom policy plugged into the engine.
+*/
+struct FirstPointsSampler {
+	template <typename Sample>
+	void draw(PhiloxRandomGenerator& /*generator*/, size_t /*noOfPoints*/, Sample& sample) const {
+		for (size_t index = 0; index < sample.size(); index++) {
+			sample[index] = index;
+		}
+	}
+};
+
+} // namespace
+
+TEST(RansacEngineTest, FitWithDefaultPolicies)
+{
+	// Arrange
+	// y = 3x - 2 with two outliers at the indexes 2 and 6
+	std::vector<double> x{ 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 };
+	std::vector<double> y{ -2.0, 1.0, 40.0, 7.0, 10.0, 13.0, -30.0, 19.0, 22.0, 25.0 };
+	RansacEngine<TwoPointLineModel, UniformSampler, ResidualSumScorer, LeastSquaresRefiner> engine;
+	RansacEngineSettings settings;
+	settings.maxIterations = 200;
+	settings.threshold = 0.5;
+	settings.minimumInliers = 5;
+	settings.seed = 1;
+
+	// Act
+	RansacEngineResult result = engine.fit(x.data(), y.data(), x.size(), settings);
+
+	// Assert
+	EXPECT_TRUE(result.modelFound);
+	EXPECT_NEAR(3.0, result.model.getSlope(), 1e-9);
+	EXPECT_NEAR(-2.0, result.model.getValueAt0(), 1e-9);
+	EXPECT_EQ(8U, result.numberOfInliers);
+	EXPECT_EQ(200U, result.numberOfIterations);
+}
+
+TEST(RansacEngineTest, CustomSamplerPolicy)
+{
+	// Arrange
+	// the first two points lie on y = x + 1, the others on y = 2x
+	std::vector<double> x{ 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 };
+	std::vector<double> y{ 1.0, 2.0, 4.0, 6.0, 8.0, 10.0 };
+	RansacEngine<TwoPointLineModel, FirstPointsSampler, ResidualSumScorer, LeastSquaresRefiner> engine;
+	RansacEngineSettings settings;
+	settings.maxIterations = 10;
+	settings.threshold = 0.1;
+	settings.minimumInliers = 2;
+
+	// Act
+	RansacEngineResult result = engine.fit(x.data(), y.data(), x.size(), settings);
+
+	// Assert
+	EXPECT_TRUE(result.modelFound);
+	EXPECT_NEAR(1.0, result.model.getSlope(), 1e-12);
+	EXPECT_NEAR(1.0, result.model.getValueAt0(), 1e-12);
+	EXPECT_EQ(2U, result.numberOfInliers);
+}
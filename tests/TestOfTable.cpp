@@ -18,6 +18,7 @@
 #include <cassert>
 #include <iostream>
 #include <limits>
+#include <memory_resource>
 
 using Column = ConsoleAppRansacIINamespace::Core::Column;
 using Table = ConsoleAppRansacIINamespace::Core::Table;
@@ -191,6 +192,52 @@ TEST(TableTest, GetCellValueFromTable)
 	// Assert
 	double expectedValue = shortColumnOne.getOneRow(rowIndex);
 	EXPECT_EQ(expectedValue, actualValue);
+	EXPECT_EQ(expectedValue, testTable.getCellValueUnchecked(rowIndex, columnIndex));
+	EXPECT_THROW(testTable.getCellValue(shortVectorOne.size(), columnIndex), Column::RowIndexOutOfBounds);
+	EXPECT_THROW(testTable.getCellValue(rowIndex, 2), Table::ColumnIndexOutOfBounds);
 }
 
+TEST(TableTest, GetColumnViewOfSpecifiedIndex)
+{
+	// Arrange
+	Table testTable{ "Test Table" };
+	testTable.appendColumn(shortColumnOne);
+	testTable.appendColumn(shortColumnTwo);
 
+	// Act
+	ConsoleAppRansacIINamespace::Core::ColumnView secondColumnView = testTable.getColumnView(1);
+	ConsoleAppRansacIINamespace::Core::ColumnView secondColumnViewAgain = testTable.getColumnView(1);
+
+	// Assert
+	std::vector<double> actualVectorFromSecondColumn(secondColumnView.begin(), secondColumnView.end());
+	EXPECT_EQ(shortVectorTwo, actualVectorFromSecondColumn);
+	EXPECT_EQ("Second vector", secondColumnView.getHeader());
+	// both views read the same values in the table, nothing is copied
+	EXPECT_EQ(secondColumnView.data(), secondColumnViewAgain.data());
+	EXPECT_THROW(testTable.getColumnView(2), Table::ColumnIndexOutOfBounds);
+}
+
+TEST(TableTest, ColumnsAllocatedFromMemoryResourceOfTable)
+{
+	// Arrange
+	std::pmr::monotonic_buffer_resource arena;
+	Table table{ "Arena table", &arena };
+	std::pmr::vector<double> arenaValues{ { 5.0, 6.0 }, &arena };
+
+	// Act
+	table.appendColumn(shortColumnOne);
+	table.appendColumn(Column{ std::move(arenaValues), "Arena vector" });
+	Table copiedTable = table;
+
+	// Assert
+	EXPECT_EQ(&arena, table.getMemoryResource());
+	EXPECT_NE(&arena, shortColumnOne.getMemoryResource());
+	ASSERT_EQ(2u, table.getNoOfColumns());
+	EXPECT_EQ(shortVectorOne, table.getColumn(0).getAllRows());
+	EXPECT_EQ(std::vector<double>({ 5.0, 6.0, 0.0 }), table.getColumn(1).getAllRows());
+	EXPECT_EQ("Arena vector", table.getColumnView(1).getHeader());
+	// the copies may outlive the arena
+	EXPECT_EQ(std::pmr::get_default_resource(), copiedTable.getMemoryResource());
+	EXPECT_EQ(std::pmr::get_default_resource(), table.getColumn(0).getMemoryResource());
+	EXPECT_EQ(2.2, copiedTable.getCellValue(2, 0));
+}
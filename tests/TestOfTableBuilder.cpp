@@ -17,6 +17,7 @@
 #include "TableBuilder.h"
 #include <gtest/gtest.h>
 #include <fstream>
+#include <memory_resource>
 #include <array>
 
 using CsvTableBuilder = ConsoleAppRansacIINamespace::IO::CsvTableBuilder;
@@ -70,3 +71,30 @@ TEST(TableBuilderTest, SimpleTableFromCSVFile)
 	}
 }
 
+TEST(TableBuilderTest, TableFromCSVFileInArena)
+{
+	// Arrange
+	std::string arenaTableTestCSVFileName = "arenaTableTest.csv";
+	std::ofstream arenaTableTestCSVFile{ arenaTableTestCSVFileName };
+	arenaTableTestCSVFile << "Arena Table\n";
+	arenaTableTestCSVFile << "x,y\n";
+	arenaTableTestCSVFile << "1.5,2\n";
+	arenaTableTestCSVFile << "-3,4e2,\n";
+	arenaTableTestCSVFile << "5\n";
+	arenaTableTestCSVFile.close();
+	std::pmr::monotonic_buffer_resource arena;
+
+	// Act
+	CsvTableBuilder csvTableBuilder{ arenaTableTestCSVFileName, 1, &arena };
+	csvTableBuilder.buildTable();
+	std::unique_ptr<Table> table = csvTableBuilder.getTable();
+
+	// Assert
+	EXPECT_EQ(&arena, table->getMemoryResource());
+	EXPECT_EQ("Arena Table", table->getName());
+	ASSERT_EQ(2u, table->getNoOfColumns());
+	EXPECT_EQ("y", table->getColumnView(1).getHeader());
+	EXPECT_EQ(std::vector<double>({ 1.5, -3.0, 5.0 }), table->getColumn(0).getAllRows());
+	// the missing value of the last row is filled by zero
+	EXPECT_EQ(std::vector<double>({ 2.0, 400.0, 0.0 }), table->getColumn(1).getAllRows());
+}
@@ -47,4 +47,39 @@ TEST(TableExportTest, SimpleTableExport)
 
 	// Assert
 	EXPECT_EQ(expectedResult, actualResult);
-}
\ No newline at end of file
+}
+
+TEST(TableExportTest, SelectedRowsExport)
+{
+	// Arrange
+	auto pRows = std::make_shared<const ConsoleAppRansacIINamespace::Core::RowSelection>(std::vector<size_t>{ 0, 2 });
+	std::vector<ConsoleAppRansacIINamespace::Core::ColumnSelection> selections{
+		{ shortColumnOne, pRows },
+		{ shortColumnTwo, pRows } };
+	std::string expectedResult =
+		"Inliers\n"
+		"First vector,Second vector,\n"
+		"0.000000,3.140000,\n"
+		"2.200000,2.718000,\n";
+
+	// Act
+	TableExport tableExport{};
+	std::string actualResult = tableExport.ExportToCsvString("Inliers", selections);
+
+	// Assert
+	EXPECT_EQ(expectedResult, actualResult);
+}
+
+TEST(TableExportTest, SelectionsOfDifferentNoOfRowsExport)
+{
+	// Arrange
+	auto pRows = std::make_shared<const ConsoleAppRansacIINamespace::Core::RowSelection>(std::vector<size_t>{ 0, 2 });
+	auto pFewerRows = std::make_shared<const ConsoleAppRansacIINamespace::Core::RowSelection>(std::vector<size_t>{ 1 });
+	std::vector<ConsoleAppRansacIINamespace::Core::ColumnSelection> selections{
+		{ shortColumnOne, pRows },
+		{ shortColumnTwo, pFewerRows } };
+	TableExport tableExport{};
+
+	// Act & Assert
+	EXPECT_THROW(tableExport.ExportToCsvString("Inliers", selections), Column::RowIndexOutOfBounds);
+}
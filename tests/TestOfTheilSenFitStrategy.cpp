@@ -0,0 +1,224 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "Column.h"
+#include "TheilSenFitStrategy.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using Column = ConsoleAppRansacIINamespace::Core::Column;
+using LinearModel = ConsoleAppRansacIINamespace::Core::LinearModel;
+using TheilSenFitStrategy = ConsoleAppRansacIINamespace::Fitting::TheilSenFitStrategy;
+
+namespace {
+
+/**
+* @brief The median of all the pairwise slopes, computed by materializing them.
+*/
+double getBruteForceMedianSlope(const std::vector<double>& x, const std::vector<double>& y) {
+	std::vector<double> slopes;
+	for (size_t first = 0; first < x.size(); first++) {
+		for (size_t second = first + 1; second < x.size(); second++) {
+			if (x[first] != x[second]) {
+				slopes.push_back((y[first] - y[second]) / (x[first] - x[second]));
+			}
+		}
+	}
+	std::sort(slopes.begin(), slopes.end());
+	size_t middle = slopes.size() / 2;
+	return (slopes.size() % 2 == 1) ? slopes[middle] : 0.5 * (slopes[middle - 1] + slopes[middle]);
+}
+
+} // namespace
+
+TEST(TheilSenFitTest, PureLinearDependency)
+{
+	// Arrange
+	// y = 2x + 1
+	std::vector<double> x(100);
+	std::vector<double> y(100);
+	for (size_t index = 0; index < x.size(); index++) {
+		x[index] = static_cast<double>(index);
+		y[index] = 2.0 * x[index] + 1.0;
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	TheilSenFitStrategy theilSenFitStrategy;
+
+	// Act
+	LinearModel linearModel = theilSenFitStrategy.fitLinearModel(xColumn, yColumn);
+
+	// Assert
+	EXPECT_DOUBLE_EQ(2.0, linearModel.getSlope());
+	EXPECT_DOUBLE_EQ(1.0, linearModel.getValueAt0());
+}
+
+TEST(TheilSenFitTest, MedianOfAllPairwiseSlopes)
+{
+	// 401 points give an even number of slopes, 402 points an odd one
+	for (size_t sizeOfData : { 401, 402 }) {
+		// Arrange
+		std::mt19937 generator(static_cast<unsigned>(sizeOfData));
+		std::normal_distribution<double> noise(0.0, 1.0);
+		std::vector<double> x(sizeOfData);
+		std::vector<double> y(sizeOfData);
+		for (size_t index = 0; index < sizeOfData; index++) {
+			x[index] = noise(generator);
+			y[index] = 0.5 * x[index] + noise(generator);
+		}
+		Column xColumn{ x, "Column X" };
+		Column yColumn{ y, "Column Y" };
+		TheilSenFitStrategy theilSenFitStrategy;
+
+		// Act
+		LinearModel linearModel = theilSenFitStrategy.fitLinearModel(xColumn, yColumn);
+
+		// Assert
+		EXPECT_DOUBLE_EQ(getBruteForceMedianSlope(x, y), linearModel.getSlope()) << sizeOfData;
+	}
+}
+
+TEST(TheilSenFitTest, QuantizedSlopesDoNotStallTheSelection)
+{
+	// the points on a grid give many tied slopes, more than are enumerated at once
+	for (unsigned seed : { 1u, 2u, 3u }) {
+		// Arrange
+		constexpr size_t sizeOfData = 398;
+		std::mt19937 generator(seed);
+		std::uniform_int_distribution<int> abcissaStep(0, 49);
+		std::uniform_int_distribution<int> ordinateStep(0, 6);
+		std::vector<double> x(sizeOfData);
+		std::vector<double> y(sizeOfData);
+		for (size_t index = 0; index < sizeOfData; index++) {
+			x[index] = 0.1 * abcissaStep(generator);
+			y[index] = 0.7 * x[index] + 0.1 * ordinateStep(generator);
+		}
+		Column xColumn{ x, "Column X" };
+		Column yColumn{ y, "Column Y" };
+		TheilSenFitStrategy theilSenFitStrategy;
+
+		// Act
+		LinearModel linearModel = theilSenFitStrategy.fitLinearModel(xColumn, yColumn);
+
+		// Assert
+		EXPECT_DOUBLE_EQ(getBruteForceMedianSlope(x, y), linearModel.getSlope()) << seed;
+	}
+}
+
+TEST(TheilSenFitTest, EqualAbcissaValuesAreSkipped)
+{
+	// Arrange
+	// every abcissa value three times, the pairs with equal abcissa values have no slope
+	std::mt19937 generator(4);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x;
+	std::vector<double> y;
+	for (int value = 0; value < 150; value++) {
+		for (int repetition = 0; repetition < 3; repetition++) {
+			x.push_back(static_cast<double>(value));
+			y.push_back(-1.5 * value + 10.0 * noise(generator));
+		}
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	TheilSenFitStrategy theilSenFitStrategy;
+
+	// Act
+	LinearModel linearModel = theilSenFitStrategy.fitLinearModel(xColumn, yColumn);
+
+	// Assert
+	EXPECT_DOUBLE_EQ(getBruteForceMedianSlope(x, y), linearModel.getSlope());
+}
+
+TEST(TheilSenFitTest, RobustToOutliers)
+{
+	// Arrange
+	// y = 3x - 2 with a small noise and every fifth point far off the line
+	constexpr size_t sizeOfData = 2000;
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = 0.01 * static_cast<double>(index);
+		y[index] = 3.0 * x[index] - 2.0 + 0.01 * std::sin(static_cast<double>(index));
+		if (index % 5 == 0) {
+			y[index] += 500.0;
+		}
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	TheilSenFitStrategy theilSenFitStrategy;
+
+	// Act
+	LinearModel linearModel = theilSenFitStrategy.fitLinearModel(xColumn, yColumn);
+
+	// Assert
+	EXPECT_NEAR(3.0, linearModel.getSlope(), 0.01);
+	EXPECT_NEAR(-2.0, linearModel.getValueAt0(), 0.05);
+}
+
+TEST(TheilSenFitTest, ParallelFitMatchesSerialFit)
+{
+	// Arrange
+	// more points than one sorted run, so the runs are merged by the threads
+	constexpr size_t sizeOfData = 10000;
+	std::mt19937 generator(8);
+	std::normal_distribution<double> noise(0.0, 1.0);
+	std::vector<double> x(sizeOfData);
+	std::vector<double> y(sizeOfData);
+	for (size_t index = 0; index < sizeOfData; index++) {
+		x[index] = noise(generator);
+		y[index] = -x[index] + 4.0 + noise(generator);
+	}
+	Column xColumn{ x, "Column X" };
+	Column yColumn{ y, "Column Y" };
+	TheilSenFitStrategy serialStrategy{ 1 };
+	TheilSenFitStrategy parallelStrategy{ 3 };
+
+	// Act
+	LinearModel serialModel = serialStrategy.fitLinearModel(xColumn, yColumn);
+	LinearModel parallelModel = parallelStrategy.fitLinearModel(xColumn, yColumn);
+
+	// Assert
+	EXPECT_EQ(serialModel.getSlope(), parallelModel.getSlope());
+	EXPECT_EQ(serialModel.getValueAt0(), parallelModel.getValueAt0());
+	EXPECT_NEAR(-1.0, serialModel.getSlope(), 0.05);
+}
+
+TEST(TheilSenFitTest, AllAbcissaValuesEqual)
+{
+	// Arrange
+	Column xColumn{ std::vector<double>{ 1.0, 1.0, 1.0 }, "Column X" };
+	Column yColumn{ std::vector<double>{ 0.0, 1.0, 2.0 }, "Column Y" };
+	TheilSenFitStrategy theilSenFitStrategy;
+
+	// Act
+	LinearModel linearModel = theilSenFitStrategy.fitLinearModel(xColumn, yColumn);
+
+	// Assert
+	EXPECT_TRUE(std::isnan(linearModel.getSlope()));
+}
+
+TEST(TheilSenFitTest, ColumnsOfDifferentNoOfRows)
+{
+	// Arrange
+	Column xColumn{ std::vector<double>{ 0.0, 1.0, 2.0, 3.0 }, "Column X" };
+	Column yColumn{ std::vector<double>{ 1.0, 3.0, 5.0 }, "Column Y" };
+	TheilSenFitStrategy theilSenFitStrategy;
+
+	// Act & Assert
+	EXPECT_THROW(theilSenFitStrategy.fitLinearModel(xColumn, yColumn), TheilSenFitStrategy::DifferentNoOfRows);
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2025 Jan Slavik, Blackstone Labs
+// 
+// This file is part of the Console-App-Ransac-III project.
+// 
+// Licensed under the MIT License. You may obtain a copy of the License at:
+// 
+//     https://opensource.org/licenses/MIT
+// 
+// This software is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ThreadPool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using ThreadPool = ConsoleAppRansacIINamespace::Core::ThreadPool;
+
+TEST(ThreadPoolTest, RunOnEachThread)
+{
+	// Arrange
+	constexpr size_t numberOfThreads = 3;
+	ThreadPool threadPool{ numberOfThreads };
+	std::vector<int> runs(numberOfThreads, 0);
+
+	// Act
+	threadPool.runOnEachThread([&runs](size_t runIndex) { runs[runIndex]++; });
+
+	// Assert
+	EXPECT_EQ(numberOfThreads, threadPool.getNumberOfThreads());
+	for (int numberOfRuns : runs) {
+		EXPECT_EQ(1, numberOfRuns);
+	}
+}
+
+TEST(ThreadPoolTest, SubmittedTasksAreExecuted)
+{
+	// Arrange
+	ThreadPool threadPool{ 2 };
+	std::atomic<int> counter{ 0 };
+	std::vector<std::future<void>> results;
+
+	// Act
+	constexpr int numberOfTasks = 100;
+	for (int index = 0; index < numberOfTasks; index++) {
+		results.push_back(threadPool.submit([&counter]() { counter++; }));
+	}
+	for (std::future<void>& result : results) {
+		result.get();
+	}
+
+	// Assert
+	EXPECT_EQ(numberOfTasks, counter.load());
+}
+
+TEST(ThreadPoolTest, ExceptionIsRethrown)
+{
+	// Arrange
+	ThreadPool threadPool{ 2 };
+
+	// Act & Assert
+	EXPECT_THROW(
+		threadPool.runOnEachThread([](size_t runIndex) {
+			if (runIndex == 1) {
+				throw std::runtime_error("failed run");
+			}
+		}),
+		std::runtime_error);
+}